@@ -0,0 +1,802 @@
+// Generated by src/interp_luts_gen.c. DO NOT EDIT!
+#ifndef INTERP_LUTS_H_
+#define INTERP_LUTS_H_
+
+#define INTERP_LUT_SIZE 1024
+
+static const float interp_luts[COUNT_INTERP_FUNCS][INTERP_LUT_SIZE + 1] = {
+    // id
+    {
+        0.000000000e+00f, 9.765625000e-04f, 1.953125000e-03f, 2.929687500e-03f, 3.906250000e-03f, 4.882812500e-03f, 5.859375000e-03f, 6.835937500e-03f, 
+        7.812500000e-03f, 8.789062500e-03f, 9.765625000e-03f, 1.074218750e-02f, 1.171875000e-02f, 1.269531250e-02f, 1.367187500e-02f, 1.464843750e-02f, 
+        1.562500000e-02f, 1.660156250e-02f, 1.757812500e-02f, 1.855468750e-02f, 1.953125000e-02f, 2.050781250e-02f, 2.148437500e-02f, 2.246093750e-02f, 
+        2.343750000e-02f, 2.441406250e-02f, 2.539062500e-02f, 2.636718750e-02f, 2.734375000e-02f, 2.832031250e-02f, 2.929687500e-02f, 3.027343750e-02f, 
+        3.125000000e-02f, 3.222656250e-02f, 3.320312500e-02f, 3.417968750e-02f, 3.515625000e-02f, 3.613281250e-02f, 3.710937500e-02f, 3.808593750e-02f, 
+        3.906250000e-02f, 4.003906250e-02f, 4.101562500e-02f, 4.199218750e-02f, 4.296875000e-02f, 4.394531250e-02f, 4.492187500e-02f, 4.589843750e-02f, 
+        4.687500000e-02f, 4.785156250e-02f, 4.882812500e-02f, 4.980468750e-02f, 5.078125000e-02f, 5.175781250e-02f, 5.273437500e-02f, 5.371093750e-02f, 
+        5.468750000e-02f, 5.566406250e-02f, 5.664062500e-02f, 5.761718750e-02f, 5.859375000e-02f, 5.957031250e-02f, 6.054687500e-02f, 6.152343750e-02f, 
+        6.250000000e-02f, 6.347656250e-02f, 6.445312500e-02f, 6.542968750e-02f, 6.640625000e-02f, 6.738281250e-02f, 6.835937500e-02f, 6.933593750e-02f, 
+        7.031250000e-02f, 7.128906250e-02f, 7.226562500e-02f, 7.324218750e-02f, 7.421875000e-02f, 7.519531250e-02f, 7.617187500e-02f, 7.714843750e-02f, 
+        7.812500000e-02f, 7.910156250e-02f, 8.007812500e-02f, 8.105468750e-02f, 8.203125000e-02f, 8.300781250e-02f, 8.398437500e-02f, 8.496093750e-02f, 
+        8.593750000e-02f, 8.691406250e-02f, 8.789062500e-02f, 8.886718750e-02f, 8.984375000e-02f, 9.082031250e-02f, 9.179687500e-02f, 9.277343750e-02f, 
+        9.375000000e-02f, 9.472656250e-02f, 9.570312500e-02f, 9.667968750e-02f, 9.765625000e-02f, 9.863281250e-02f, 9.960937500e-02f, 1.005859375e-01f, 
+        1.015625000e-01f, 1.025390625e-01f, 1.035156250e-01f, 1.044921875e-01f, 1.054687500e-01f, 1.064453125e-01f, 1.074218750e-01f, 1.083984375e-01f, 
+        1.093750000e-01f, 1.103515625e-01f, 1.113281250e-01f, 1.123046875e-01f, 1.132812500e-01f, 1.142578125e-01f, 1.152343750e-01f, 1.162109375e-01f, 
+        1.171875000e-01f, 1.181640625e-01f, 1.191406250e-01f, 1.201171875e-01f, 1.210937500e-01f, 1.220703125e-01f, 1.230468750e-01f, 1.240234375e-01f, 
+        1.250000000e-01f, 1.259765625e-01f, 1.269531250e-01f, 1.279296875e-01f, 1.289062500e-01f, 1.298828125e-01f, 1.308593750e-01f, 1.318359375e-01f, 
+        1.328125000e-01f, 1.337890625e-01f, 1.347656250e-01f, 1.357421875e-01f, 1.367187500e-01f, 1.376953125e-01f, 1.386718750e-01f, 1.396484375e-01f, 
+        1.406250000e-01f, 1.416015625e-01f, 1.425781250e-01f, 1.435546875e-01f, 1.445312500e-01f, 1.455078125e-01f, 1.464843750e-01f, 1.474609375e-01f, 
+        1.484375000e-01f, 1.494140625e-01f, 1.503906250e-01f, 1.513671875e-01f, 1.523437500e-01f, 1.533203125e-01f, 1.542968750e-01f, 1.552734375e-01f, 
+        1.562500000e-01f, 1.572265625e-01f, 1.582031250e-01f, 1.591796875e-01f, 1.601562500e-01f, 1.611328125e-01f, 1.621093750e-01f, 1.630859375e-01f, 
+        1.640625000e-01f, 1.650390625e-01f, 1.660156250e-01f, 1.669921875e-01f, 1.679687500e-01f, 1.689453125e-01f, 1.699218750e-01f, 1.708984375e-01f, 
+        1.718750000e-01f, 1.728515625e-01f, 1.738281250e-01f, 1.748046875e-01f, 1.757812500e-01f, 1.767578125e-01f, 1.777343750e-01f, 1.787109375e-01f, 
+        1.796875000e-01f, 1.806640625e-01f, 1.816406250e-01f, 1.826171875e-01f, 1.835937500e-01f, 1.845703125e-01f, 1.855468750e-01f, 1.865234375e-01f, 
+        1.875000000e-01f, 1.884765625e-01f, 1.894531250e-01f, 1.904296875e-01f, 1.914062500e-01f, 1.923828125e-01f, 1.933593750e-01f, 1.943359375e-01f, 
+        1.953125000e-01f, 1.962890625e-01f, 1.972656250e-01f, 1.982421875e-01f, 1.992187500e-01f, 2.001953125e-01f, 2.011718750e-01f, 2.021484375e-01f, 
+        2.031250000e-01f, 2.041015625e-01f, 2.050781250e-01f, 2.060546875e-01f, 2.070312500e-01f, 2.080078125e-01f, 2.089843750e-01f, 2.099609375e-01f, 
+        2.109375000e-01f, 2.119140625e-01f, 2.128906250e-01f, 2.138671875e-01f, 2.148437500e-01f, 2.158203125e-01f, 2.167968750e-01f, 2.177734375e-01f, 
+        2.187500000e-01f, 2.197265625e-01f, 2.207031250e-01f, 2.216796875e-01f, 2.226562500e-01f, 2.236328125e-01f, 2.246093750e-01f, 2.255859375e-01f, 
+        2.265625000e-01f, 2.275390625e-01f, 2.285156250e-01f, 2.294921875e-01f, 2.304687500e-01f, 2.314453125e-01f, 2.324218750e-01f, 2.333984375e-01f, 
+        2.343750000e-01f, 2.353515625e-01f, 2.363281250e-01f, 2.373046875e-01f, 2.382812500e-01f, 2.392578125e-01f, 2.402343750e-01f, 2.412109375e-01f, 
+        2.421875000e-01f, 2.431640625e-01f, 2.441406250e-01f, 2.451171875e-01f, 2.460937500e-01f, 2.470703125e-01f, 2.480468750e-01f, 2.490234375e-01f, 
+        2.500000000e-01f, 2.509765625e-01f, 2.519531250e-01f, 2.529296875e-01f, 2.539062500e-01f, 2.548828125e-01f, 2.558593750e-01f, 2.568359375e-01f, 
+        2.578125000e-01f, 2.587890625e-01f, 2.597656250e-01f, 2.607421875e-01f, 2.617187500e-01f, 2.626953125e-01f, 2.636718750e-01f, 2.646484375e-01f, 
+        2.656250000e-01f, 2.666015625e-01f, 2.675781250e-01f, 2.685546875e-01f, 2.695312500e-01f, 2.705078125e-01f, 2.714843750e-01f, 2.724609375e-01f, 
+        2.734375000e-01f, 2.744140625e-01f, 2.753906250e-01f, 2.763671875e-01f, 2.773437500e-01f, 2.783203125e-01f, 2.792968750e-01f, 2.802734375e-01f, 
+        2.812500000e-01f, 2.822265625e-01f, 2.832031250e-01f, 2.841796875e-01f, 2.851562500e-01f, 2.861328125e-01f, 2.871093750e-01f, 2.880859375e-01f, 
+        2.890625000e-01f, 2.900390625e-01f, 2.910156250e-01f, 2.919921875e-01f, 2.929687500e-01f, 2.939453125e-01f, 2.949218750e-01f, 2.958984375e-01f, 
+        2.968750000e-01f, 2.978515625e-01f, 2.988281250e-01f, 2.998046875e-01f, 3.007812500e-01f, 3.017578125e-01f, 3.027343750e-01f, 3.037109375e-01f, 
+        3.046875000e-01f, 3.056640625e-01f, 3.066406250e-01f, 3.076171875e-01f, 3.085937500e-01f, 3.095703125e-01f, 3.105468750e-01f, 3.115234375e-01f, 
+        3.125000000e-01f, 3.134765625e-01f, 3.144531250e-01f, 3.154296875e-01f, 3.164062500e-01f, 3.173828125e-01f, 3.183593750e-01f, 3.193359375e-01f, 
+        3.203125000e-01f, 3.212890625e-01f, 3.222656250e-01f, 3.232421875e-01f, 3.242187500e-01f, 3.251953125e-01f, 3.261718750e-01f, 3.271484375e-01f, 
+        3.281250000e-01f, 3.291015625e-01f, 3.300781250e-01f, 3.310546875e-01f, 3.320312500e-01f, 3.330078125e-01f, 3.339843750e-01f, 3.349609375e-01f, 
+        3.359375000e-01f, 3.369140625e-01f, 3.378906250e-01f, 3.388671875e-01f, 3.398437500e-01f, 3.408203125e-01f, 3.417968750e-01f, 3.427734375e-01f, 
+        3.437500000e-01f, 3.447265625e-01f, 3.457031250e-01f, 3.466796875e-01f, 3.476562500e-01f, 3.486328125e-01f, 3.496093750e-01f, 3.505859375e-01f, 
+        3.515625000e-01f, 3.525390625e-01f, 3.535156250e-01f, 3.544921875e-01f, 3.554687500e-01f, 3.564453125e-01f, 3.574218750e-01f, 3.583984375e-01f, 
+        3.593750000e-01f, 3.603515625e-01f, 3.613281250e-01f, 3.623046875e-01f, 3.632812500e-01f, 3.642578125e-01f, 3.652343750e-01f, 3.662109375e-01f, 
+        3.671875000e-01f, 3.681640625e-01f, 3.691406250e-01f, 3.701171875e-01f, 3.710937500e-01f, 3.720703125e-01f, 3.730468750e-01f, 3.740234375e-01f, 
+        3.750000000e-01f, 3.759765625e-01f, 3.769531250e-01f, 3.779296875e-01f, 3.789062500e-01f, 3.798828125e-01f, 3.808593750e-01f, 3.818359375e-01f, 
+        3.828125000e-01f, 3.837890625e-01f, 3.847656250e-01f, 3.857421875e-01f, 3.867187500e-01f, 3.876953125e-01f, 3.886718750e-01f, 3.896484375e-01f, 
+        3.906250000e-01f, 3.916015625e-01f, 3.925781250e-01f, 3.935546875e-01f, 3.945312500e-01f, 3.955078125e-01f, 3.964843750e-01f, 3.974609375e-01f, 
+        3.984375000e-01f, 3.994140625e-01f, 4.003906250e-01f, 4.013671875e-01f, 4.023437500e-01f, 4.033203125e-01f, 4.042968750e-01f, 4.052734375e-01f, 
+        4.062500000e-01f, 4.072265625e-01f, 4.082031250e-01f, 4.091796875e-01f, 4.101562500e-01f, 4.111328125e-01f, 4.121093750e-01f, 4.130859375e-01f, 
+        4.140625000e-01f, 4.150390625e-01f, 4.160156250e-01f, 4.169921875e-01f, 4.179687500e-01f, 4.189453125e-01f, 4.199218750e-01f, 4.208984375e-01f, 
+        4.218750000e-01f, 4.228515625e-01f, 4.238281250e-01f, 4.248046875e-01f, 4.257812500e-01f, 4.267578125e-01f, 4.277343750e-01f, 4.287109375e-01f, 
+        4.296875000e-01f, 4.306640625e-01f, 4.316406250e-01f, 4.326171875e-01f, 4.335937500e-01f, 4.345703125e-01f, 4.355468750e-01f, 4.365234375e-01f, 
+        4.375000000e-01f, 4.384765625e-01f, 4.394531250e-01f, 4.404296875e-01f, 4.414062500e-01f, 4.423828125e-01f, 4.433593750e-01f, 4.443359375e-01f, 
+        4.453125000e-01f, 4.462890625e-01f, 4.472656250e-01f, 4.482421875e-01f, 4.492187500e-01f, 4.501953125e-01f, 4.511718750e-01f, 4.521484375e-01f, 
+        4.531250000e-01f, 4.541015625e-01f, 4.550781250e-01f, 4.560546875e-01f, 4.570312500e-01f, 4.580078125e-01f, 4.589843750e-01f, 4.599609375e-01f, 
+        4.609375000e-01f, 4.619140625e-01f, 4.628906250e-01f, 4.638671875e-01f, 4.648437500e-01f, 4.658203125e-01f, 4.667968750e-01f, 4.677734375e-01f, 
+        4.687500000e-01f, 4.697265625e-01f, 4.707031250e-01f, 4.716796875e-01f, 4.726562500e-01f, 4.736328125e-01f, 4.746093750e-01f, 4.755859375e-01f, 
+        4.765625000e-01f, 4.775390625e-01f, 4.785156250e-01f, 4.794921875e-01f, 4.804687500e-01f, 4.814453125e-01f, 4.824218750e-01f, 4.833984375e-01f, 
+        4.843750000e-01f, 4.853515625e-01f, 4.863281250e-01f, 4.873046875e-01f, 4.882812500e-01f, 4.892578125e-01f, 4.902343750e-01f, 4.912109375e-01f, 
+        4.921875000e-01f, 4.931640625e-01f, 4.941406250e-01f, 4.951171875e-01f, 4.960937500e-01f, 4.970703125e-01f, 4.980468750e-01f, 4.990234375e-01f, 
+        5.000000000e-01f, 5.009765625e-01f, 5.019531250e-01f, 5.029296875e-01f, 5.039062500e-01f, 5.048828125e-01f, 5.058593750e-01f, 5.068359375e-01f, 
+        5.078125000e-01f, 5.087890625e-01f, 5.097656250e-01f, 5.107421875e-01f, 5.117187500e-01f, 5.126953125e-01f, 5.136718750e-01f, 5.146484375e-01f, 
+        5.156250000e-01f, 5.166015625e-01f, 5.175781250e-01f, 5.185546875e-01f, 5.195312500e-01f, 5.205078125e-01f, 5.214843750e-01f, 5.224609375e-01f, 
+        5.234375000e-01f, 5.244140625e-01f, 5.253906250e-01f, 5.263671875e-01f, 5.273437500e-01f, 5.283203125e-01f, 5.292968750e-01f, 5.302734375e-01f, 
+        5.312500000e-01f, 5.322265625e-01f, 5.332031250e-01f, 5.341796875e-01f, 5.351562500e-01f, 5.361328125e-01f, 5.371093750e-01f, 5.380859375e-01f, 
+        5.390625000e-01f, 5.400390625e-01f, 5.410156250e-01f, 5.419921875e-01f, 5.429687500e-01f, 5.439453125e-01f, 5.449218750e-01f, 5.458984375e-01f, 
+        5.468750000e-01f, 5.478515625e-01f, 5.488281250e-01f, 5.498046875e-01f, 5.507812500e-01f, 5.517578125e-01f, 5.527343750e-01f, 5.537109375e-01f, 
+        5.546875000e-01f, 5.556640625e-01f, 5.566406250e-01f, 5.576171875e-01f, 5.585937500e-01f, 5.595703125e-01f, 5.605468750e-01f, 5.615234375e-01f, 
+        5.625000000e-01f, 5.634765625e-01f, 5.644531250e-01f, 5.654296875e-01f, 5.664062500e-01f, 5.673828125e-01f, 5.683593750e-01f, 5.693359375e-01f, 
+        5.703125000e-01f, 5.712890625e-01f, 5.722656250e-01f, 5.732421875e-01f, 5.742187500e-01f, 5.751953125e-01f, 5.761718750e-01f, 5.771484375e-01f, 
+        5.781250000e-01f, 5.791015625e-01f, 5.800781250e-01f, 5.810546875e-01f, 5.820312500e-01f, 5.830078125e-01f, 5.839843750e-01f, 5.849609375e-01f, 
+        5.859375000e-01f, 5.869140625e-01f, 5.878906250e-01f, 5.888671875e-01f, 5.898437500e-01f, 5.908203125e-01f, 5.917968750e-01f, 5.927734375e-01f, 
+        5.937500000e-01f, 5.947265625e-01f, 5.957031250e-01f, 5.966796875e-01f, 5.976562500e-01f, 5.986328125e-01f, 5.996093750e-01f, 6.005859375e-01f, 
+        6.015625000e-01f, 6.025390625e-01f, 6.035156250e-01f, 6.044921875e-01f, 6.054687500e-01f, 6.064453125e-01f, 6.074218750e-01f, 6.083984375e-01f, 
+        6.093750000e-01f, 6.103515625e-01f, 6.113281250e-01f, 6.123046875e-01f, 6.132812500e-01f, 6.142578125e-01f, 6.152343750e-01f, 6.162109375e-01f, 
+        6.171875000e-01f, 6.181640625e-01f, 6.191406250e-01f, 6.201171875e-01f, 6.210937500e-01f, 6.220703125e-01f, 6.230468750e-01f, 6.240234375e-01f, 
+        6.250000000e-01f, 6.259765625e-01f, 6.269531250e-01f, 6.279296875e-01f, 6.289062500e-01f, 6.298828125e-01f, 6.308593750e-01f, 6.318359375e-01f, 
+        6.328125000e-01f, 6.337890625e-01f, 6.347656250e-01f, 6.357421875e-01f, 6.367187500e-01f, 6.376953125e-01f, 6.386718750e-01f, 6.396484375e-01f, 
+        6.406250000e-01f, 6.416015625e-01f, 6.425781250e-01f, 6.435546875e-01f, 6.445312500e-01f, 6.455078125e-01f, 6.464843750e-01f, 6.474609375e-01f, 
+        6.484375000e-01f, 6.494140625e-01f, 6.503906250e-01f, 6.513671875e-01f, 6.523437500e-01f, 6.533203125e-01f, 6.542968750e-01f, 6.552734375e-01f, 
+        6.562500000e-01f, 6.572265625e-01f, 6.582031250e-01f, 6.591796875e-01f, 6.601562500e-01f, 6.611328125e-01f, 6.621093750e-01f, 6.630859375e-01f, 
+        6.640625000e-01f, 6.650390625e-01f, 6.660156250e-01f, 6.669921875e-01f, 6.679687500e-01f, 6.689453125e-01f, 6.699218750e-01f, 6.708984375e-01f, 
+        6.718750000e-01f, 6.728515625e-01f, 6.738281250e-01f, 6.748046875e-01f, 6.757812500e-01f, 6.767578125e-01f, 6.777343750e-01f, 6.787109375e-01f, 
+        6.796875000e-01f, 6.806640625e-01f, 6.816406250e-01f, 6.826171875e-01f, 6.835937500e-01f, 6.845703125e-01f, 6.855468750e-01f, 6.865234375e-01f, 
+        6.875000000e-01f, 6.884765625e-01f, 6.894531250e-01f, 6.904296875e-01f, 6.914062500e-01f, 6.923828125e-01f, 6.933593750e-01f, 6.943359375e-01f, 
+        6.953125000e-01f, 6.962890625e-01f, 6.972656250e-01f, 6.982421875e-01f, 6.992187500e-01f, 7.001953125e-01f, 7.011718750e-01f, 7.021484375e-01f, 
+        7.031250000e-01f, 7.041015625e-01f, 7.050781250e-01f, 7.060546875e-01f, 7.070312500e-01f, 7.080078125e-01f, 7.089843750e-01f, 7.099609375e-01f, 
+        7.109375000e-01f, 7.119140625e-01f, 7.128906250e-01f, 7.138671875e-01f, 7.148437500e-01f, 7.158203125e-01f, 7.167968750e-01f, 7.177734375e-01f, 
+        7.187500000e-01f, 7.197265625e-01f, 7.207031250e-01f, 7.216796875e-01f, 7.226562500e-01f, 7.236328125e-01f, 7.246093750e-01f, 7.255859375e-01f, 
+        7.265625000e-01f, 7.275390625e-01f, 7.285156250e-01f, 7.294921875e-01f, 7.304687500e-01f, 7.314453125e-01f, 7.324218750e-01f, 7.333984375e-01f, 
+        7.343750000e-01f, 7.353515625e-01f, 7.363281250e-01f, 7.373046875e-01f, 7.382812500e-01f, 7.392578125e-01f, 7.402343750e-01f, 7.412109375e-01f, 
+        7.421875000e-01f, 7.431640625e-01f, 7.441406250e-01f, 7.451171875e-01f, 7.460937500e-01f, 7.470703125e-01f, 7.480468750e-01f, 7.490234375e-01f, 
+        7.500000000e-01f, 7.509765625e-01f, 7.519531250e-01f, 7.529296875e-01f, 7.539062500e-01f, 7.548828125e-01f, 7.558593750e-01f, 7.568359375e-01f, 
+        7.578125000e-01f, 7.587890625e-01f, 7.597656250e-01f, 7.607421875e-01f, 7.617187500e-01f, 7.626953125e-01f, 7.636718750e-01f, 7.646484375e-01f, 
+        7.656250000e-01f, 7.666015625e-01f, 7.675781250e-01f, 7.685546875e-01f, 7.695312500e-01f, 7.705078125e-01f, 7.714843750e-01f, 7.724609375e-01f, 
+        7.734375000e-01f, 7.744140625e-01f, 7.753906250e-01f, 7.763671875e-01f, 7.773437500e-01f, 7.783203125e-01f, 7.792968750e-01f, 7.802734375e-01f, 
+        7.812500000e-01f, 7.822265625e-01f, 7.832031250e-01f, 7.841796875e-01f, 7.851562500e-01f, 7.861328125e-01f, 7.871093750e-01f, 7.880859375e-01f, 
+        7.890625000e-01f, 7.900390625e-01f, 7.910156250e-01f, 7.919921875e-01f, 7.929687500e-01f, 7.939453125e-01f, 7.949218750e-01f, 7.958984375e-01f, 
+        7.968750000e-01f, 7.978515625e-01f, 7.988281250e-01f, 7.998046875e-01f, 8.007812500e-01f, 8.017578125e-01f, 8.027343750e-01f, 8.037109375e-01f, 
+        8.046875000e-01f, 8.056640625e-01f, 8.066406250e-01f, 8.076171875e-01f, 8.085937500e-01f, 8.095703125e-01f, 8.105468750e-01f, 8.115234375e-01f, 
+        8.125000000e-01f, 8.134765625e-01f, 8.144531250e-01f, 8.154296875e-01f, 8.164062500e-01f, 8.173828125e-01f, 8.183593750e-01f, 8.193359375e-01f, 
+        8.203125000e-01f, 8.212890625e-01f, 8.222656250e-01f, 8.232421875e-01f, 8.242187500e-01f, 8.251953125e-01f, 8.261718750e-01f, 8.271484375e-01f, 
+        8.281250000e-01f, 8.291015625e-01f, 8.300781250e-01f, 8.310546875e-01f, 8.320312500e-01f, 8.330078125e-01f, 8.339843750e-01f, 8.349609375e-01f, 
+        8.359375000e-01f, 8.369140625e-01f, 8.378906250e-01f, 8.388671875e-01f, 8.398437500e-01f, 8.408203125e-01f, 8.417968750e-01f, 8.427734375e-01f, 
+        8.437500000e-01f, 8.447265625e-01f, 8.457031250e-01f, 8.466796875e-01f, 8.476562500e-01f, 8.486328125e-01f, 8.496093750e-01f, 8.505859375e-01f, 
+        8.515625000e-01f, 8.525390625e-01f, 8.535156250e-01f, 8.544921875e-01f, 8.554687500e-01f, 8.564453125e-01f, 8.574218750e-01f, 8.583984375e-01f, 
+        8.593750000e-01f, 8.603515625e-01f, 8.613281250e-01f, 8.623046875e-01f, 8.632812500e-01f, 8.642578125e-01f, 8.652343750e-01f, 8.662109375e-01f, 
+        8.671875000e-01f, 8.681640625e-01f, 8.691406250e-01f, 8.701171875e-01f, 8.710937500e-01f, 8.720703125e-01f, 8.730468750e-01f, 8.740234375e-01f, 
+        8.750000000e-01f, 8.759765625e-01f, 8.769531250e-01f, 8.779296875e-01f, 8.789062500e-01f, 8.798828125e-01f, 8.808593750e-01f, 8.818359375e-01f, 
+        8.828125000e-01f, 8.837890625e-01f, 8.847656250e-01f, 8.857421875e-01f, 8.867187500e-01f, 8.876953125e-01f, 8.886718750e-01f, 8.896484375e-01f, 
+        8.906250000e-01f, 8.916015625e-01f, 8.925781250e-01f, 8.935546875e-01f, 8.945312500e-01f, 8.955078125e-01f, 8.964843750e-01f, 8.974609375e-01f, 
+        8.984375000e-01f, 8.994140625e-01f, 9.003906250e-01f, 9.013671875e-01f, 9.023437500e-01f, 9.033203125e-01f, 9.042968750e-01f, 9.052734375e-01f, 
+        9.062500000e-01f, 9.072265625e-01f, 9.082031250e-01f, 9.091796875e-01f, 9.101562500e-01f, 9.111328125e-01f, 9.121093750e-01f, 9.130859375e-01f, 
+        9.140625000e-01f, 9.150390625e-01f, 9.160156250e-01f, 9.169921875e-01f, 9.179687500e-01f, 9.189453125e-01f, 9.199218750e-01f, 9.208984375e-01f, 
+        9.218750000e-01f, 9.228515625e-01f, 9.238281250e-01f, 9.248046875e-01f, 9.257812500e-01f, 9.267578125e-01f, 9.277343750e-01f, 9.287109375e-01f, 
+        9.296875000e-01f, 9.306640625e-01f, 9.316406250e-01f, 9.326171875e-01f, 9.335937500e-01f, 9.345703125e-01f, 9.355468750e-01f, 9.365234375e-01f, 
+        9.375000000e-01f, 9.384765625e-01f, 9.394531250e-01f, 9.404296875e-01f, 9.414062500e-01f, 9.423828125e-01f, 9.433593750e-01f, 9.443359375e-01f, 
+        9.453125000e-01f, 9.462890625e-01f, 9.472656250e-01f, 9.482421875e-01f, 9.492187500e-01f, 9.501953125e-01f, 9.511718750e-01f, 9.521484375e-01f, 
+        9.531250000e-01f, 9.541015625e-01f, 9.550781250e-01f, 9.560546875e-01f, 9.570312500e-01f, 9.580078125e-01f, 9.589843750e-01f, 9.599609375e-01f, 
+        9.609375000e-01f, 9.619140625e-01f, 9.628906250e-01f, 9.638671875e-01f, 9.648437500e-01f, 9.658203125e-01f, 9.667968750e-01f, 9.677734375e-01f, 
+        9.687500000e-01f, 9.697265625e-01f, 9.707031250e-01f, 9.716796875e-01f, 9.726562500e-01f, 9.736328125e-01f, 9.746093750e-01f, 9.755859375e-01f, 
+        9.765625000e-01f, 9.775390625e-01f, 9.785156250e-01f, 9.794921875e-01f, 9.804687500e-01f, 9.814453125e-01f, 9.824218750e-01f, 9.833984375e-01f, 
+        9.843750000e-01f, 9.853515625e-01f, 9.863281250e-01f, 9.873046875e-01f, 9.882812500e-01f, 9.892578125e-01f, 9.902343750e-01f, 9.912109375e-01f, 
+        9.921875000e-01f, 9.931640625e-01f, 9.941406250e-01f, 9.951171875e-01f, 9.960937500e-01f, 9.970703125e-01f, 9.980468750e-01f, 9.990234375e-01f, 
+        1.000000000e+00f, 
+    },
+    // sinstep
+    {
+        0.000000000e+00f, 2.354383469e-06f, 9.417533875e-06f, 2.118945122e-05f, 3.764033318e-05f, 5.882978439e-05f, 8.469820023e-05f, 1.153051853e-04f, 
+        1.505911350e-04f, 1.905858517e-04f, 2.352893353e-04f, 2.847015858e-04f, 3.387928009e-04f, 3.976225853e-04f, 4.611313343e-04f, 5.293488503e-04f, 
+        6.022751331e-04f, 6.798803806e-04f, 7.622241974e-04f, 8.492171764e-04f, 9.409487247e-04f, 1.037359238e-03f, 1.138448715e-03f, 1.244276762e-03f, 
+        1.354783773e-03f, 1.469969749e-03f, 1.589834690e-03f, 1.714438200e-03f, 1.843690872e-03f, 1.977652311e-03f, 2.116292715e-03f, 2.259612083e-03f, 
+        2.407640219e-03f, 2.560347319e-03f, 2.717703581e-03f, 2.879768610e-03f, 3.046512604e-03f, 3.217935562e-03f, 3.394007683e-03f, 3.574788570e-03f, 
+        3.760218620e-03f, 3.950327635e-03f, 4.145115614e-03f, 4.344582558e-03f, 4.548668861e-03f, 4.757463932e-03f, 4.970908165e-03f, 5.189001560e-03f, 
+        5.411744118e-03f, 5.639165640e-03f, 5.871206522e-03f, 6.107926369e-03f, 6.349295378e-03f, 6.595283747e-03f, 6.845951080e-03f, 7.101237774e-03f, 
+        7.361173630e-03f, 7.625758648e-03f, 7.894963026e-03f, 8.168786764e-03f, 8.447259665e-03f, 8.730351925e-03f, 9.018063545e-03f, 9.310394526e-03f, 
+        9.607344866e-03f, 9.908914566e-03f, 1.021510363e-02f, 1.052591205e-02f, 1.084131002e-02f, 1.116132736e-02f, 1.148593426e-02f, 1.181513071e-02f, 
+        1.214894652e-02f, 1.248732209e-02f, 1.283031702e-02f, 1.317787170e-02f, 1.353001595e-02f, 1.388674974e-02f, 1.424804330e-02f, 1.461392641e-02f, 
+        1.498436928e-02f, 1.535937190e-02f, 1.573893428e-02f, 1.612308621e-02f, 1.651176810e-02f, 1.690500975e-02f, 1.730278134e-02f, 1.770511270e-02f, 
+        1.811197400e-02f, 1.852336526e-02f, 1.893928647e-02f, 1.935973763e-02f, 1.978471875e-02f, 2.021422982e-02f, 2.064824104e-02f, 2.108678222e-02f, 
+        2.152982354e-02f, 2.197736502e-02f, 2.242940664e-02f, 2.288594842e-02f, 2.334699035e-02f, 2.381250262e-02f, 2.428248525e-02f, 2.475696802e-02f, 
+        2.523592114e-02f, 2.571934462e-02f, 2.620717883e-02f, 2.669954300e-02f, 2.719631791e-02f, 2.769756317e-02f, 2.820327878e-02f, 2.871340513e-02f, 
+        2.922797203e-02f, 2.974694967e-02f, 3.027039766e-02f, 3.079822659e-02f, 3.133046627e-02f, 3.186714649e-02f, 3.240823746e-02f, 3.295370936e-02f, 
+        3.350359201e-02f, 3.405785561e-02f, 3.461650014e-02f, 3.517955542e-02f, 3.574696183e-02f, 3.631871939e-02f, 3.689488769e-02f, 3.747537732e-02f, 
+        3.806024790e-02f, 3.864943981e-02f, 3.924298286e-02f, 3.984087706e-02f, 4.044309258e-02f, 4.104962945e-02f, 4.166045785e-02f, 4.227563739e-02f, 
+        4.289510846e-02f, 4.351890087e-02f, 4.414698482e-02f, 4.477936029e-02f, 4.541599751e-02f, 4.605692625e-02f, 4.670214653e-02f, 4.735162854e-02f, 
+        4.800534248e-02f, 4.866331816e-02f, 4.932555556e-02f, 4.999202490e-02f, 5.066275597e-02f, 5.133768916e-02f, 5.201685429e-02f, 5.270025134e-02f, 
+        5.338785052e-02f, 5.407965183e-02f, 5.477562547e-02f, 5.547583103e-02f, 5.618017912e-02f, 5.688872933e-02f, 5.760145187e-02f, 5.831834674e-02f, 
+        5.903938413e-02f, 5.976453424e-02f, 6.049385667e-02f, 6.122735143e-02f, 6.196492910e-02f, 6.270667911e-02f, 6.345251203e-02f, 6.420245767e-02f, 
+        6.495651603e-02f, 6.571465731e-02f, 6.647685170e-02f, 6.724315882e-02f, 6.801354885e-02f, 6.878799200e-02f, 6.956651807e-02f, 7.034906745e-02f, 
+        7.113566995e-02f, 7.192632556e-02f, 7.272100449e-02f, 7.351967692e-02f, 7.432240248e-02f, 7.512912154e-02f, 7.593983412e-02f, 7.675454021e-02f, 
+        7.757321000e-02f, 7.839587331e-02f, 7.922253013e-02f, 8.005309105e-02f, 8.088764548e-02f, 8.172613382e-02f, 8.256855607e-02f, 8.341491222e-02f, 
+        8.426517248e-02f, 8.511936665e-02f, 8.597746491e-02f, 8.683946729e-02f, 8.770534396e-02f, 8.857509494e-02f, 8.944872022e-02f, 9.032621980e-02f, 
+        9.120759368e-02f, 9.209278226e-02f, 9.298184514e-02f, 9.387469292e-02f, 9.477141500e-02f, 9.567189217e-02f, 9.657621384e-02f, 9.748432040e-02f, 
+        9.839624166e-02f, 9.931191802e-02f, 1.002313495e-01f, 1.011545658e-01f, 1.020815372e-01f, 1.030122638e-01f, 1.039467156e-01f, 1.048848927e-01f, 
+        1.058267951e-01f, 1.067723930e-01f, 1.077216864e-01f, 1.086746752e-01f, 1.096313596e-01f, 1.105917394e-01f, 1.115557551e-01f, 1.125234365e-01f, 
+        1.134947836e-01f, 1.144697070e-01f, 1.154483259e-01f, 1.164305210e-01f, 1.174163520e-01f, 1.184057891e-01f, 1.193988025e-01f, 1.203953922e-01f, 
+        1.213955581e-01f, 1.223993003e-01f, 1.234065890e-01f, 1.244174242e-01f, 1.254318058e-01f, 1.264497042e-01f, 1.274711192e-01f, 1.284960210e-01f, 
+        1.295244098e-01f, 1.305563152e-01f, 1.315917075e-01f, 1.326305568e-01f, 1.336728632e-01f, 1.347186267e-01f, 1.357677877e-01f, 1.368204057e-01f, 
+        1.378764510e-01f, 1.389358938e-01f, 1.399987340e-01f, 1.410649717e-01f, 1.421345770e-01f, 1.432075500e-01f, 1.442838907e-01f, 1.453635693e-01f, 
+        1.464466155e-01f, 1.475329697e-01f, 1.486226320e-01f, 1.497156024e-01f, 1.508118510e-01f, 1.519114077e-01f, 1.530142725e-01f, 1.541203558e-01f, 
+        1.552297175e-01f, 1.563423276e-01f, 1.574581563e-01f, 1.585772038e-01f, 1.596994996e-01f, 1.608249545e-01f, 1.619536281e-01f, 1.630854905e-01f, 
+        1.642205119e-01f, 1.653586924e-01f, 1.665000319e-01f, 1.676445007e-01f, 1.687920988e-01f, 1.699428260e-01f, 1.710966527e-01f, 1.722535789e-01f, 
+        1.734135747e-01f, 1.745766401e-01f, 1.757427752e-01f, 1.769119799e-01f, 1.780842245e-01f, 1.792594790e-01f, 1.804377735e-01f, 1.816190779e-01f, 
+        1.828033328e-01f, 1.839906275e-01f, 1.851808727e-01f, 1.863740981e-01f, 1.875702441e-01f, 1.887693703e-01f, 1.899713874e-01f, 1.911763251e-01f, 
+        1.923841834e-01f, 1.935949624e-01f, 1.948086023e-01f, 1.960251033e-01f, 1.972444952e-01f, 1.984666884e-01f, 1.996917427e-01f, 2.009196281e-01f, 
+        2.021503448e-01f, 2.033838332e-01f, 2.046201527e-01f, 2.058592141e-01f, 2.071010470e-01f, 2.083456516e-01f, 2.095929980e-01f, 2.108430862e-01f, 
+        2.120958865e-01f, 2.133514285e-01f, 2.146096230e-01f, 2.158704996e-01f, 2.171340883e-01f, 2.184003294e-01f, 2.196691930e-01f, 2.209407389e-01f, 
+        2.222148776e-01f, 2.234916389e-01f, 2.247709930e-01f, 2.260529697e-01f, 2.273375094e-01f, 2.286246121e-01f, 2.299142480e-01f, 2.312064469e-01f, 
+        2.325011790e-01f, 2.337984145e-01f, 2.350981832e-01f, 2.364004254e-01f, 2.377051413e-01f, 2.390123606e-01f, 2.403219938e-01f, 2.416341007e-01f, 
+        2.429486513e-01f, 2.442655861e-01f, 2.455849349e-01f, 2.469066978e-01f, 2.482307851e-01f, 2.495572865e-01f, 2.508861423e-01f, 2.522173524e-01f, 
+        2.535508871e-01f, 2.548867464e-01f, 2.562249303e-01f, 2.575653791e-01f, 2.589081228e-01f, 2.602531314e-01f, 2.616003752e-01f, 2.629499137e-01f, 
+        2.643016577e-01f, 2.656555772e-01f, 2.670117319e-01f, 2.683700919e-01f, 2.697306275e-01f, 2.710933387e-01f, 2.724581957e-01f, 2.738251984e-01f, 
+        2.751943469e-01f, 2.765655816e-01f, 2.779389322e-01f, 2.793143690e-01f, 2.806918919e-01f, 2.820714712e-01f, 2.834531069e-01f, 2.848367095e-01f, 
+        2.862224281e-01f, 2.876101434e-01f, 2.889998555e-01f, 2.903915346e-01f, 2.917852104e-01f, 2.931808233e-01f, 2.945784032e-01f, 2.959779203e-01f, 
+        2.973793447e-01f, 2.987826765e-01f, 3.001879156e-01f, 3.015950322e-01f, 3.030039966e-01f, 3.044147789e-01f, 3.058274388e-01f, 3.072419465e-01f, 
+        3.086582720e-01f, 3.100763857e-01f, 3.114962876e-01f, 3.129179478e-01f, 3.143413961e-01f, 3.157665730e-01f, 3.171935081e-01f, 3.186221421e-01f, 
+        3.200525045e-01f, 3.214845359e-01f, 3.229182363e-01f, 3.243535757e-01f, 3.257906437e-01f, 3.272293210e-01f, 3.286696076e-01f, 3.301115632e-01f, 
+        3.315550685e-01f, 3.330001831e-01f, 3.344468474e-01f, 3.358950615e-01f, 3.373448551e-01f, 3.387961686e-01f, 3.402490020e-01f, 3.417033255e-01f, 
+        3.431591392e-01f, 3.446164131e-01f, 3.460751474e-01f, 3.475353718e-01f, 3.489969969e-01f, 3.504600525e-01f, 3.519245386e-01f, 3.533903956e-01f, 
+        3.548576534e-01f, 3.563262820e-01f, 3.577962518e-01f, 3.592675328e-01f, 3.607401848e-01f, 3.622140884e-01f, 3.636893630e-01f, 3.651658297e-01f, 
+        3.666436076e-01f, 3.681226373e-01f, 3.696029186e-01f, 3.710844517e-01f, 3.725671768e-01f, 3.740510941e-01f, 3.755362034e-01f, 3.770224750e-01f, 
+        3.785099089e-01f, 3.799985051e-01f, 3.814882040e-01f, 3.829790354e-01f, 3.844709098e-01f, 3.859639168e-01f, 3.874580264e-01f, 3.889531791e-01f, 
+        3.904493749e-01f, 3.919465840e-01f, 3.934448361e-01f, 3.949440718e-01f, 3.964443207e-01f, 3.979455233e-01f, 3.994476795e-01f, 4.009508193e-01f, 
+        4.024548531e-01f, 4.039598107e-01f, 4.054656327e-01f, 4.069724083e-01f, 4.084800482e-01f, 4.099885225e-01f, 4.114978909e-01f, 4.130080640e-01f, 
+        4.145190418e-01f, 4.160308540e-01f, 4.175434411e-01f, 4.190568030e-01f, 4.205709398e-01f, 4.220858216e-01f, 4.236014187e-01f, 4.251177609e-01f, 
+        4.266347289e-01f, 4.281524420e-01f, 4.296708703e-01f, 4.311899245e-01f, 4.327096343e-01f, 4.342299700e-01f, 4.357509315e-01f, 4.372725189e-01f, 
+        4.387946725e-01f, 4.403173923e-01f, 4.418407083e-01f, 4.433645308e-01f, 4.448889196e-01f, 4.464138150e-01f, 4.479391575e-01f, 4.494650364e-01f, 
+        4.509914219e-01f, 4.525182247e-01f, 4.540455043e-01f, 4.555732012e-01f, 4.571013451e-01f, 4.586298764e-01f, 4.601587951e-01f, 4.616880715e-01f, 
+        4.632177353e-01f, 4.647477269e-01f, 4.662780762e-01f, 4.678087234e-01f, 4.693396091e-01f, 4.708708525e-01f, 4.724023640e-01f, 4.739341438e-01f, 
+        4.754661620e-01f, 4.769983888e-01f, 4.785308838e-01f, 4.800635278e-01f, 4.815964103e-01f, 4.831294119e-01f, 4.846626222e-01f, 4.861959517e-01f, 
+        4.877294004e-01f, 4.892629981e-01f, 4.907965958e-01f, 4.923303723e-01f, 4.938642085e-01f, 4.953981042e-01f, 4.969320595e-01f, 4.984660149e-01f, 
+        5.000000000e-01f, 5.015339851e-01f, 5.030679703e-01f, 5.046018958e-01f, 5.061357617e-01f, 5.076696277e-01f, 5.092033744e-01f, 5.107370019e-01f, 
+        5.122705698e-01f, 5.138040781e-01f, 5.153374076e-01f, 5.168705583e-01f, 5.184035897e-01f, 5.199364424e-01f, 5.214691162e-01f, 5.230016112e-01f, 
+        5.245338678e-01f, 5.260658860e-01f, 5.275976658e-01f, 5.291291475e-01f, 5.306603909e-01f, 5.321912766e-01f, 5.337219238e-01f, 5.352522731e-01f, 
+        5.367822647e-01f, 5.383118987e-01f, 5.398412347e-01f, 5.413701534e-01f, 5.428986549e-01f, 5.444267988e-01f, 5.459544659e-01f, 5.474817753e-01f, 
+        5.490086079e-01f, 5.505349636e-01f, 5.520608425e-01f, 5.535861850e-01f, 5.551110506e-01f, 5.566354394e-01f, 5.581592917e-01f, 5.596826077e-01f, 
+        5.612053275e-01f, 5.627275109e-01f, 5.642490387e-01f, 5.657700300e-01f, 5.672903657e-01f, 5.688101053e-01f, 5.703291297e-01f, 5.718475580e-01f, 
+        5.733652711e-01f, 5.748822689e-01f, 5.763985515e-01f, 5.779141784e-01f, 5.794290304e-01f, 5.809431672e-01f, 5.824565887e-01f, 5.839691162e-01f, 
+        5.854809284e-01f, 5.869919658e-01f, 5.885021091e-01f, 5.900114775e-01f, 5.915199518e-01f, 5.930275917e-01f, 5.945343375e-01f, 5.960401893e-01f, 
+        5.975451469e-01f, 5.990492105e-01f, 6.005523205e-01f, 6.020544767e-01f, 6.035556793e-01f, 6.050559282e-01f, 6.065551639e-01f, 6.080533862e-01f, 
+        6.095506549e-01f, 6.110468507e-01f, 6.125419736e-01f, 6.140360832e-01f, 6.155290604e-01f, 6.170209646e-01f, 6.185117960e-01f, 6.200014949e-01f, 
+        6.214900613e-01f, 6.229774952e-01f, 6.244637966e-01f, 6.259489059e-01f, 6.274328232e-01f, 6.289155483e-01f, 6.303970814e-01f, 6.318773627e-01f, 
+        6.333563924e-01f, 6.348341703e-01f, 6.363106370e-01f, 6.377859116e-01f, 6.392598152e-01f, 6.407324672e-01f, 6.422037482e-01f, 6.436737180e-01f, 
+        6.451423168e-01f, 6.466096044e-01f, 6.480754614e-01f, 6.495399475e-01f, 6.510030031e-01f, 6.524646282e-01f, 6.539248228e-01f, 6.553835869e-01f, 
+        6.568408608e-01f, 6.582967043e-01f, 6.597509980e-01f, 6.612038612e-01f, 6.626551151e-01f, 6.641049385e-01f, 6.655531526e-01f, 6.669998169e-01f, 
+        6.684449315e-01f, 6.698884368e-01f, 6.713303924e-01f, 6.727706790e-01f, 6.742093563e-01f, 6.756464243e-01f, 6.770817637e-01f, 6.785154343e-01f, 
+        6.799474955e-01f, 6.813778877e-01f, 6.828064919e-01f, 6.842334270e-01f, 6.856585741e-01f, 6.870820522e-01f, 6.885037422e-01f, 6.899236441e-01f, 
+        6.913417578e-01f, 6.927580833e-01f, 6.941725612e-01f, 6.955852509e-01f, 6.969959736e-01f, 6.984049678e-01f, 6.998120546e-01f, 7.012172937e-01f, 
+        7.026206255e-01f, 7.040220499e-01f, 7.054215670e-01f, 7.068191767e-01f, 7.082147598e-01f, 7.096084356e-01f, 7.110000849e-01f, 7.123898268e-01f, 
+        7.137775421e-01f, 7.151632309e-01f, 7.165468931e-01f, 7.179285288e-01f, 7.193081379e-01f, 7.206856012e-01f, 7.220610380e-01f, 7.234344482e-01f, 
+        7.248056531e-01f, 7.261748314e-01f, 7.275418043e-01f, 7.289066315e-01f, 7.302693725e-01f, 7.316299081e-01f, 7.329882383e-01f, 7.343444228e-01f, 
+        7.356984019e-01f, 7.370501757e-01f, 7.383996248e-01f, 7.397469282e-01f, 7.410919666e-01f, 7.424346805e-01f, 7.437751293e-01f, 7.451131940e-01f, 
+        7.464490533e-01f, 7.477825880e-01f, 7.491137981e-01f, 7.504426241e-01f, 7.517691851e-01f, 7.530933022e-01f, 7.544150352e-01f, 7.557344437e-01f, 
+        7.570513487e-01f, 7.583658695e-01f, 7.596780062e-01f, 7.609876394e-01f, 7.622948885e-01f, 7.635995746e-01f, 7.649018168e-01f, 7.662016153e-01f, 
+        7.674988508e-01f, 7.687935829e-01f, 7.700857520e-01f, 7.713754177e-01f, 7.726625204e-01f, 7.739470601e-01f, 7.752290368e-01f, 7.765083909e-01f, 
+        7.777851820e-01f, 7.790592909e-01f, 7.803307772e-01f, 7.815996408e-01f, 7.828658819e-01f, 7.841294408e-01f, 7.853903770e-01f, 7.866485715e-01f, 
+        7.879040837e-01f, 7.891569138e-01f, 7.904069424e-01f, 7.916543484e-01f, 7.928988934e-01f, 7.941408157e-01f, 7.953798771e-01f, 7.966161966e-01f, 
+        7.978496552e-01f, 7.990803719e-01f, 8.003082275e-01f, 8.015333414e-01f, 8.027555346e-01f, 8.039749265e-01f, 8.051913977e-01f, 8.064050674e-01f, 
+        8.076158762e-01f, 8.088237047e-01f, 8.100286722e-01f, 8.112306595e-01f, 8.124297857e-01f, 8.136259317e-01f, 8.148190975e-01f, 8.160093427e-01f, 
+        8.171966076e-01f, 8.183808923e-01f, 8.195621967e-01f, 8.207404613e-01f, 8.219157457e-01f, 8.230879903e-01f, 8.242571950e-01f, 8.254233599e-01f, 
+        8.265864253e-01f, 8.277463913e-01f, 8.289033175e-01f, 8.300571442e-01f, 8.312078714e-01f, 8.323554993e-01f, 8.334999681e-01f, 8.346413374e-01f, 
+        8.357794881e-01f, 8.369145393e-01f, 8.380463719e-01f, 8.391750455e-01f, 8.403005600e-01f, 8.414227962e-01f, 8.425418735e-01f, 8.436577320e-01f, 
+        8.447703123e-01f, 8.458796740e-01f, 8.469856977e-01f, 8.480885029e-01f, 8.491880894e-01f, 8.502843380e-01f, 8.513773680e-01f, 8.524670601e-01f, 
+        8.535534143e-01f, 8.546364307e-01f, 8.557161093e-01f, 8.567924500e-01f, 8.578654528e-01f, 8.589349985e-01f, 8.600012660e-01f, 8.610640764e-01f, 
+        8.621235490e-01f, 8.631795645e-01f, 8.642321825e-01f, 8.652814031e-01f, 8.663271666e-01f, 8.673694730e-01f, 8.684083223e-01f, 8.694436550e-01f, 
+        8.704755902e-01f, 8.715040088e-01f, 8.725289106e-01f, 8.735503554e-01f, 8.745682240e-01f, 8.755825758e-01f, 8.765933514e-01f, 8.776006699e-01f, 
+        8.786044121e-01f, 8.796045780e-01f, 8.806011677e-01f, 8.815941811e-01f, 8.825836182e-01f, 8.835694790e-01f, 8.845516443e-01f, 8.855302334e-01f, 
+        8.865052462e-01f, 8.874765635e-01f, 8.884442449e-01f, 8.894082308e-01f, 8.903686404e-01f, 8.913253546e-01f, 8.922783136e-01f, 8.932276368e-01f, 
+        8.941732645e-01f, 8.951151371e-01f, 8.960533142e-01f, 8.969877958e-01f, 8.979184628e-01f, 8.988454342e-01f, 8.997687101e-01f, 9.006881118e-01f, 
+        9.016038179e-01f, 9.025156498e-01f, 9.034237862e-01f, 9.043281078e-01f, 9.052286148e-01f, 9.061253071e-01f, 9.070181847e-01f, 9.079071879e-01f, 
+        9.087923765e-01f, 9.096737504e-01f, 9.105512500e-01f, 9.114248753e-01f, 9.122946262e-01f, 9.131605625e-01f, 9.140225649e-01f, 9.148806334e-01f, 
+        9.157348275e-01f, 9.165850878e-01f, 9.174314737e-01f, 9.182739258e-01f, 9.191123843e-01f, 9.199469090e-01f, 9.207774997e-01f, 9.216041565e-01f, 
+        9.224268198e-01f, 9.232454896e-01f, 9.240602255e-01f, 9.248709083e-01f, 9.256776571e-01f, 9.264802933e-01f, 9.272789955e-01f, 9.280736446e-01f, 
+        9.288643003e-01f, 9.296509027e-01f, 9.304334521e-01f, 9.312119484e-01f, 9.319864511e-01f, 9.327567816e-01f, 9.335231185e-01f, 9.342853427e-01f, 
+        9.350434542e-01f, 9.357975721e-01f, 9.365475178e-01f, 9.372932911e-01f, 9.380350709e-01f, 9.387726784e-01f, 9.395061731e-01f, 9.402354956e-01f, 
+        9.409606457e-01f, 9.416816831e-01f, 9.423985481e-01f, 9.431113005e-01f, 9.438198805e-01f, 9.445241690e-01f, 9.452244043e-01f, 9.459203482e-01f, 
+        9.466121197e-01f, 9.472997189e-01f, 9.479831457e-01f, 9.486622810e-01f, 9.493372440e-01f, 9.500079155e-01f, 9.506744146e-01f, 9.513366222e-01f, 
+        9.519946575e-01f, 9.526484013e-01f, 9.532978535e-01f, 9.539430737e-01f, 9.545840025e-01f, 9.552206397e-01f, 9.558529854e-01f, 9.564810991e-01f, 
+        9.571049213e-01f, 9.577243328e-01f, 9.583395720e-01f, 9.589504004e-01f, 9.595569372e-01f, 9.601591825e-01f, 9.607570171e-01f, 9.613505602e-01f, 
+        9.619398117e-01f, 9.625246525e-01f, 9.631051421e-01f, 9.636812806e-01f, 9.642530680e-01f, 9.648204446e-01f, 9.653834701e-01f, 9.659421444e-01f, 
+        9.664963484e-01f, 9.670462608e-01f, 9.675917625e-01f, 9.681328535e-01f, 9.686695337e-01f, 9.692018032e-01f, 9.697296023e-01f, 9.702530503e-01f, 
+        9.707720280e-01f, 9.712865949e-01f, 9.717967510e-01f, 9.723024368e-01f, 9.728037119e-01f, 9.733004570e-01f, 9.737927914e-01f, 9.742807150e-01f, 
+        9.747641087e-01f, 9.752430916e-01f, 9.757175446e-01f, 9.761875272e-01f, 9.766530395e-01f, 9.771140814e-01f, 9.775705934e-01f, 9.780226350e-01f, 
+        9.784701467e-01f, 9.789131880e-01f, 9.793517590e-01f, 9.797857404e-01f, 9.802152514e-01f, 9.806402326e-01f, 9.810607433e-01f, 9.814766645e-01f, 
+        9.818880558e-01f, 9.822949171e-01f, 9.826972485e-01f, 9.830949903e-01f, 9.834882021e-01f, 9.838769436e-01f, 9.842610359e-01f, 9.846405983e-01f, 
+        9.850156307e-01f, 9.853860736e-01f, 9.857519865e-01f, 9.861132503e-01f, 9.864699841e-01f, 9.868221283e-01f, 9.871697426e-01f, 9.875127077e-01f, 
+        9.878510833e-01f, 9.881848693e-01f, 9.885140657e-01f, 9.888386726e-01f, 9.891586900e-01f, 9.894740582e-01f, 9.897848368e-01f, 9.900910854e-01f, 
+        9.903926253e-01f, 9.906896353e-01f, 9.909819365e-01f, 9.912696481e-01f, 9.915527105e-01f, 9.918311834e-01f, 9.921050072e-01f, 9.923742414e-01f, 
+        9.926388264e-01f, 9.928987622e-01f, 9.931540489e-01f, 9.934047461e-01f, 9.936506748e-01f, 9.938920736e-01f, 9.941288233e-01f, 9.943608642e-01f, 
+        9.945882559e-01f, 9.948110580e-01f, 9.950290918e-01f, 9.952425957e-01f, 9.954513311e-01f, 9.956554174e-01f, 9.958548546e-01f, 9.960496426e-01f, 
+        9.962397814e-01f, 9.964252114e-01f, 9.966059923e-01f, 9.967820644e-01f, 9.969534874e-01f, 9.971202612e-01f, 9.972822666e-01f, 9.974396229e-01f, 
+        9.975923300e-01f, 9.977403879e-01f, 9.978836775e-01f, 9.980223179e-01f, 9.981563091e-01f, 9.982855320e-01f, 9.984101653e-01f, 9.985300303e-01f, 
+        9.986451864e-01f, 9.987556934e-01f, 9.988615513e-01f, 9.989626408e-01f, 9.990590811e-01f, 9.991507530e-01f, 9.992377758e-01f, 9.993201494e-01f, 
+        9.993977547e-01f, 9.994706511e-01f, 9.995388985e-01f, 9.996023774e-01f, 9.996612072e-01f, 9.997153282e-01f, 9.997646809e-01f, 9.998093843e-01f, 
+        9.998494387e-01f, 9.998847246e-01f, 9.999153018e-01f, 9.999411702e-01f, 9.999623299e-01f, 9.999787807e-01f, 9.999905825e-01f, 9.999976158e-01f, 
+        1.000000000e+00f, 
+    },
+    // smoothstep
+    {
+        0.000000000e+00f, 2.859160304e-06f, 1.142919064e-05f, 2.569891512e-05f, 4.565715790e-05f, 7.129274309e-05f, 1.025944948e-04f, 1.395512372e-04f, 
+        1.821517944e-04f, 2.303849906e-04f, 2.842396498e-04f, 3.437045962e-04f, 4.087686539e-04f, 4.794206470e-04f, 5.556493998e-04f, 6.374437362e-04f, 
+        7.247924805e-04f, 8.176844567e-04f, 9.161084890e-04f, 1.020053402e-03f, 1.129508018e-03f, 1.244461164e-03f, 1.364901662e-03f, 1.490818337e-03f, 
+        1.622200012e-03f, 1.759035513e-03f, 1.901313663e-03f, 2.049023286e-03f, 2.202153206e-03f, 2.360692248e-03f, 2.524629235e-03f, 2.693952993e-03f, 
+        2.868652344e-03f, 3.048716113e-03f, 3.234133124e-03f, 3.424892202e-03f, 3.620982170e-03f, 3.822391853e-03f, 4.029110074e-03f, 4.241125658e-03f, 
+        4.458427429e-03f, 4.681004211e-03f, 4.908844829e-03f, 5.141938105e-03f, 5.380272865e-03f, 5.623837933e-03f, 5.872622132e-03f, 6.126614287e-03f, 
+        6.385803223e-03f, 6.650177762e-03f, 6.919726729e-03f, 7.194438949e-03f, 7.474303246e-03f, 7.759308442e-03f, 8.049443364e-03f, 8.344696835e-03f, 
+        8.645057678e-03f, 8.950514719e-03f, 9.261056781e-03f, 9.576672688e-03f, 9.897351265e-03f, 1.022308134e-02f, 1.055385172e-02f, 1.088965125e-02f, 
+        1.123046875e-02f, 1.157629304e-02f, 1.192711294e-02f, 1.228291728e-02f, 1.264369488e-02f, 1.300943457e-02f, 1.338012516e-02f, 1.375575550e-02f, 
+        1.413631439e-02f, 1.452179067e-02f, 1.491217315e-02f, 1.530745067e-02f, 1.570761204e-02f, 1.611264609e-02f, 1.652254164e-02f, 1.693728752e-02f, 
+        1.735687256e-02f, 1.778128557e-02f, 1.821051538e-02f, 1.864455082e-02f, 1.908338070e-02f, 1.952699386e-02f, 1.997537911e-02f, 2.042852528e-02f, 
+        2.088642120e-02f, 2.134905569e-02f, 2.181641757e-02f, 2.228849567e-02f, 2.276527882e-02f, 2.324675582e-02f, 2.373291552e-02f, 2.422374673e-02f, 
+        2.471923828e-02f, 2.521937899e-02f, 2.572415769e-02f, 2.623356320e-02f, 2.674758434e-02f, 2.726620995e-02f, 2.778942883e-02f, 2.831722982e-02f, 
+        2.884960175e-02f, 2.938653342e-02f, 2.992801368e-02f, 3.047403134e-02f, 3.102457523e-02f, 3.157963604e-02f, 3.213919699e-02f, 3.270325065e-02f, 
+        3.327178955e-02f, 3.384479880e-02f, 3.442226350e-02f, 3.500417620e-02f, 3.559052944e-02f, 3.618130833e-02f, 3.677649796e-02f, 3.737609088e-02f, 
+        3.798007965e-02f, 3.858844936e-02f, 3.920118511e-02f, 3.981827945e-02f, 4.043972492e-02f, 4.106550664e-02f, 4.169560969e-02f, 4.233002663e-02f, 
+        4.296875000e-02f, 4.361176491e-02f, 4.425905645e-02f, 4.491061717e-02f, 4.556643963e-02f, 4.622650892e-02f, 4.689081013e-02f, 4.755933583e-02f, 
+        4.823207855e-02f, 4.890902340e-02f, 4.959015548e-02f, 5.027546734e-02f, 5.096495152e-02f, 5.165859312e-02f, 5.235637724e-02f, 5.305829644e-02f, 
+        5.376434326e-02f, 5.447450280e-02f, 5.518876016e-02f, 5.590710789e-02f, 5.662953854e-02f, 5.735603720e-02f, 5.808658898e-02f, 5.882118642e-02f, 
+        5.955982208e-02f, 6.030248106e-02f, 6.104914844e-02f, 6.179981679e-02f, 6.255447865e-02f, 6.331311911e-02f, 6.407572329e-02f, 6.484228373e-02f, 
+        6.561279297e-02f, 6.638723612e-02f, 6.716559827e-02f, 6.794787198e-02f, 6.873404980e-02f, 6.952411681e-02f, 7.031805813e-02f, 7.111586630e-02f, 
+        7.191753387e-02f, 7.272304595e-02f, 7.353238761e-02f, 7.434555143e-02f, 7.516252995e-02f, 7.598330826e-02f, 7.680787146e-02f, 7.763621211e-02f, 
+        7.846832275e-02f, 7.930418849e-02f, 8.014379442e-02f, 8.098713309e-02f, 8.183419704e-02f, 8.268497139e-02f, 8.353944123e-02f, 8.439759910e-02f, 
+        8.525943756e-02f, 8.612494171e-02f, 8.699409664e-02f, 8.786689490e-02f, 8.874332905e-02f, 8.962338418e-02f, 9.050704539e-02f, 9.139430523e-02f, 
+        9.228515625e-02f, 9.317958355e-02f, 9.407757223e-02f, 9.497911483e-02f, 9.588420391e-02f, 9.679282457e-02f, 9.770496190e-02f, 9.862060845e-02f, 
+        9.953975677e-02f, 1.004623920e-01f, 1.013884991e-01f, 1.023180708e-01f, 1.032510996e-01f, 1.041875705e-01f, 1.051274687e-01f, 1.060707867e-01f, 
+        1.070175171e-01f, 1.079676449e-01f, 1.089211553e-01f, 1.098780409e-01f, 1.108382940e-01f, 1.118019000e-01f, 1.127688438e-01f, 1.137391180e-01f, 
+        1.147127151e-01f, 1.156896204e-01f, 1.166698188e-01f, 1.176533028e-01f, 1.186400652e-01f, 1.196300909e-01f, 1.206233650e-01f, 1.216198802e-01f, 
+        1.226196289e-01f, 1.236225963e-01f, 1.246287674e-01f, 1.256381422e-01f, 1.266506910e-01f, 1.276664138e-01f, 1.286853105e-01f, 1.297073513e-01f, 
+        1.307325363e-01f, 1.317608505e-01f, 1.327922791e-01f, 1.338268220e-01f, 1.348644495e-01f, 1.359051615e-01f, 1.369489580e-01f, 1.379958093e-01f, 
+        1.390457153e-01f, 1.400986612e-01f, 1.411546320e-01f, 1.422136277e-01f, 1.432756186e-01f, 1.443406045e-01f, 1.454085857e-01f, 1.464795321e-01f, 
+        1.475534439e-01f, 1.486303061e-01f, 1.497101039e-01f, 1.507928371e-01f, 1.518784761e-01f, 1.529670209e-01f, 1.540584713e-01f, 1.551527977e-01f, 
+        1.562500000e-01f, 1.573500633e-01f, 1.584529728e-01f, 1.595587134e-01f, 1.606673002e-01f, 1.617786884e-01f, 1.628928930e-01f, 1.640098840e-01f, 
+        1.651296616e-01f, 1.662522107e-01f, 1.673775166e-01f, 1.685055792e-01f, 1.696363688e-01f, 1.707699001e-01f, 1.719061285e-01f, 1.730450690e-01f, 
+        1.741867065e-01f, 1.753310263e-01f, 1.764780134e-01f, 1.776276529e-01f, 1.787799597e-01f, 1.799348891e-01f, 1.810924560e-01f, 1.822526306e-01f, 
+        1.834154129e-01f, 1.845807880e-01f, 1.857487410e-01f, 1.869192719e-01f, 1.880923510e-01f, 1.892679930e-01f, 1.904461533e-01f, 1.916268468e-01f, 
+        1.928100586e-01f, 1.939957738e-01f, 1.951839775e-01f, 1.963746548e-01f, 1.975678205e-01f, 1.987634301e-01f, 1.999614984e-01f, 2.011619955e-01f, 
+        2.023649216e-01f, 2.035702616e-01f, 2.047780007e-01f, 2.059881389e-01f, 2.072006464e-01f, 2.084155381e-01f, 2.096327692e-01f, 2.108523548e-01f, 
+        2.120742798e-01f, 2.132985294e-01f, 2.145250887e-01f, 2.157539427e-01f, 2.169851065e-01f, 2.182185352e-01f, 2.194542438e-01f, 2.206922024e-01f, 
+        2.219324112e-01f, 2.231748551e-01f, 2.244195193e-01f, 2.256664038e-01f, 2.269154787e-01f, 2.281667590e-01f, 2.294202000e-01f, 2.306758165e-01f, 
+        2.319335938e-01f, 2.331935167e-01f, 2.344555706e-01f, 2.357197404e-01f, 2.369860411e-01f, 2.382544279e-01f, 2.395249158e-01f, 2.407974750e-01f, 
+        2.420721054e-01f, 2.433487922e-01f, 2.446275204e-01f, 2.459082901e-01f, 2.471910715e-01f, 2.484758794e-01f, 2.497626692e-01f, 2.510514557e-01f, 
+        2.523422241e-01f, 2.536349595e-01f, 2.549296618e-01f, 2.562262714e-01f, 2.575248480e-01f, 2.588253319e-01f, 2.601277232e-01f, 2.614320517e-01f, 
+        2.627382278e-01f, 2.640463114e-01f, 2.653562427e-01f, 2.666680217e-01f, 2.679816484e-01f, 2.692971230e-01f, 2.706143856e-01f, 2.719334960e-01f, 
+        2.732543945e-01f, 2.745770812e-01f, 2.759015560e-01f, 2.772277594e-01f, 2.785557508e-01f, 2.798854709e-01f, 2.812169194e-01f, 2.825500965e-01f, 
+        2.838850021e-01f, 2.852215767e-01f, 2.865598798e-01f, 2.878998220e-01f, 2.892414331e-01f, 2.905847132e-01f, 2.919296026e-01f, 2.932761610e-01f, 
+        2.946243286e-01f, 2.959741056e-01f, 2.973254919e-01f, 2.986784279e-01f, 3.000329733e-01f, 3.013890684e-01f, 3.027467132e-01f, 3.041059375e-01f, 
+        3.054666519e-01f, 3.068289161e-01f, 3.081926703e-01f, 3.095579147e-01f, 3.109246492e-01f, 3.122928739e-01f, 3.136625290e-01f, 3.150336742e-01f, 
+        3.164062500e-01f, 3.177802563e-01f, 3.191556931e-01f, 3.205325007e-01f, 3.219107389e-01f, 3.232903481e-01f, 3.246713281e-01f, 3.260536790e-01f, 
+        3.274374008e-01f, 3.288224339e-01f, 3.302088380e-01f, 3.315965235e-01f, 3.329855204e-01f, 3.343758285e-01f, 3.357673883e-01f, 3.371602595e-01f, 
+        3.385543823e-01f, 3.399497569e-01f, 3.413463831e-01f, 3.427442014e-01f, 3.441432714e-01f, 3.455435336e-01f, 3.469449878e-01f, 3.483476639e-01f, 
+        3.497514725e-01f, 3.511564732e-01f, 3.525626063e-01f, 3.539698720e-01f, 3.553782701e-01f, 3.567878008e-01f, 3.581984043e-01f, 3.596101403e-01f, 
+        3.610229492e-01f, 3.624368310e-01f, 3.638517857e-01f, 3.652677536e-01f, 3.666847944e-01f, 3.681028485e-01f, 3.695219159e-01f, 3.709419966e-01f, 
+        3.723630905e-01f, 3.737851381e-01f, 3.752081990e-01f, 3.766321838e-01f, 3.780571222e-01f, 3.794829845e-01f, 3.809098005e-01f, 3.823375404e-01f, 
+        3.837661743e-01f, 3.851957023e-01f, 3.866261244e-01f, 3.880574107e-01f, 3.894895315e-01f, 3.909225166e-01f, 3.923563361e-01f, 3.937910199e-01f, 
+        3.952264786e-01f, 3.966627717e-01f, 3.980998397e-01f, 3.995376825e-01f, 4.009763002e-01f, 4.024156928e-01f, 4.038558006e-01f, 4.052966833e-01f, 
+        4.067382812e-01f, 4.081805944e-01f, 4.096236229e-01f, 4.110673070e-01f, 4.125117064e-01f, 4.139567614e-01f, 4.154024720e-01f, 4.168488383e-01f, 
+        4.182958603e-01f, 4.197434783e-01f, 4.211917520e-01f, 4.226405919e-01f, 4.240900278e-01f, 4.255400300e-01f, 4.269906282e-01f, 4.284417927e-01f, 
+        4.298934937e-01f, 4.313457310e-01f, 4.327985048e-01f, 4.342517853e-01f, 4.357055426e-01f, 4.371598065e-01f, 4.386145473e-01f, 4.400697947e-01f, 
+        4.415254593e-01f, 4.429816008e-01f, 4.444381595e-01f, 4.458951354e-01f, 4.473525286e-01f, 4.488103390e-01f, 4.502685070e-01f, 4.517270923e-01f, 
+        4.531860352e-01f, 4.546453357e-01f, 4.561049938e-01f, 4.575649500e-01f, 4.590252638e-01f, 4.604858756e-01f, 4.619467854e-01f, 4.634079933e-01f, 
+        4.648694992e-01f, 4.663312435e-01f, 4.677932858e-01f, 4.692555368e-01f, 4.707180262e-01f, 4.721807241e-01f, 4.736436605e-01f, 4.751068056e-01f, 
+        4.765701294e-01f, 4.780336320e-01f, 4.794973135e-01f, 4.809611440e-01f, 4.824250937e-01f, 4.838891923e-01f, 4.853534102e-01f, 4.868177772e-01f, 
+        4.882822037e-01f, 4.897467494e-01f, 4.912113547e-01f, 4.926760197e-01f, 4.941407442e-01f, 4.956055284e-01f, 4.970703125e-01f, 4.985351562e-01f, 
+        5.000000000e-01f, 5.014648438e-01f, 5.029296875e-01f, 5.043944716e-01f, 5.058592558e-01f, 5.073239803e-01f, 5.087886453e-01f, 5.102533102e-01f, 
+        5.117177963e-01f, 5.131822228e-01f, 5.146465898e-01f, 5.161107779e-01f, 5.175749063e-01f, 5.190389156e-01f, 5.205026865e-01f, 5.219663382e-01f, 
+        5.234298706e-01f, 5.248931646e-01f, 5.263563395e-01f, 5.278192759e-01f, 5.292819738e-01f, 5.307444334e-01f, 5.322067142e-01f, 5.336687565e-01f, 
+        5.351305008e-01f, 5.365920067e-01f, 5.380532146e-01f, 5.395141244e-01f, 5.409747362e-01f, 5.424350500e-01f, 5.438950062e-01f, 5.453546643e-01f, 
+        5.468139648e-01f, 5.482729077e-01f, 5.497314930e-01f, 5.511896610e-01f, 5.526474714e-01f, 5.541048646e-01f, 5.555618405e-01f, 5.570183992e-01f, 
+        5.584745407e-01f, 5.599302053e-01f, 5.613854527e-01f, 5.628402233e-01f, 5.642944574e-01f, 5.657482147e-01f, 5.672014952e-01f, 5.686542988e-01f, 
+        5.701065063e-01f, 5.715582371e-01f, 5.730093718e-01f, 5.744599104e-01f, 5.759099722e-01f, 5.773594379e-01f, 5.788082480e-01f, 5.802565217e-01f, 
+        5.817041397e-01f, 5.831511021e-01f, 5.845975280e-01f, 5.860432386e-01f, 5.874882936e-01f, 5.889326930e-01f, 5.903763771e-01f, 5.918194056e-01f, 
+        5.932617188e-01f, 5.947033167e-01f, 5.961441994e-01f, 5.975843072e-01f, 5.990236998e-01f, 6.004623175e-01f, 6.019001603e-01f, 6.033372879e-01f, 
+        6.047735214e-01f, 6.062089801e-01f, 6.076436639e-01f, 6.090774536e-01f, 6.105104685e-01f, 6.119426489e-01f, 6.133738756e-01f, 6.148042679e-01f, 
+        6.162338257e-01f, 6.176624298e-01f, 6.190901995e-01f, 6.205170155e-01f, 6.219428778e-01f, 6.233677864e-01f, 6.247918010e-01f, 6.262148619e-01f, 
+        6.276369095e-01f, 6.290580034e-01f, 6.304780841e-01f, 6.318971515e-01f, 6.333152056e-01f, 6.347322464e-01f, 6.361482143e-01f, 6.375631690e-01f, 
+        6.389770508e-01f, 6.403898597e-01f, 6.418015957e-01f, 6.432121992e-01f, 6.446217299e-01f, 6.460301280e-01f, 6.474373937e-01f, 6.488435268e-01f, 
+        6.502485275e-01f, 6.516523361e-01f, 6.530550122e-01f, 6.544564962e-01f, 6.558567286e-01f, 6.572557688e-01f, 6.586536169e-01f, 6.600502729e-01f, 
+        6.614456177e-01f, 6.628397703e-01f, 6.642326117e-01f, 6.656241417e-01f, 6.670144796e-01f, 6.684035063e-01f, 6.697911620e-01f, 6.711775661e-01f, 
+        6.725625992e-01f, 6.739462614e-01f, 6.753286719e-01f, 6.767096519e-01f, 6.780892611e-01f, 6.794674993e-01f, 6.808443069e-01f, 6.822197437e-01f, 
+        6.835937500e-01f, 6.849663258e-01f, 6.863374710e-01f, 6.877071261e-01f, 6.890753508e-01f, 6.904420853e-01f, 6.918073297e-01f, 6.931710839e-01f, 
+        6.945333481e-01f, 6.958940625e-01f, 6.972532868e-01f, 6.986109018e-01f, 6.999670267e-01f, 7.013215423e-01f, 7.026745081e-01f, 7.040259242e-01f, 
+        7.053756714e-01f, 7.067238092e-01f, 7.080703974e-01f, 7.094153166e-01f, 7.107585669e-01f, 7.121002078e-01f, 7.134401202e-01f, 7.147784233e-01f, 
+        7.161149979e-01f, 7.174499035e-01f, 7.187830806e-01f, 7.201145291e-01f, 7.214442492e-01f, 7.227722406e-01f, 7.240984440e-01f, 7.254229188e-01f, 
+        7.267456055e-01f, 7.280665040e-01f, 7.293856144e-01f, 7.307028770e-01f, 7.320183516e-01f, 7.333319783e-01f, 7.346437573e-01f, 7.359536886e-01f, 
+        7.372617722e-01f, 7.385679483e-01f, 7.398722768e-01f, 7.411746383e-01f, 7.424751520e-01f, 7.437736988e-01f, 7.450703382e-01f, 7.463650703e-01f, 
+        7.476577759e-01f, 7.489485145e-01f, 7.502373457e-01f, 7.515241504e-01f, 7.528089285e-01f, 7.540917397e-01f, 7.553724647e-01f, 7.566512227e-01f, 
+        7.579278946e-01f, 7.592025399e-01f, 7.604750991e-01f, 7.617455721e-01f, 7.630139589e-01f, 7.642802596e-01f, 7.655444145e-01f, 7.668064833e-01f, 
+        7.680664062e-01f, 7.693241835e-01f, 7.705798149e-01f, 7.718332410e-01f, 7.730845213e-01f, 7.743335962e-01f, 7.755804658e-01f, 7.768251300e-01f, 
+        7.780675888e-01f, 7.793077826e-01f, 7.805457711e-01f, 7.817814350e-01f, 7.830148935e-01f, 7.842460275e-01f, 7.854748964e-01f, 7.867015004e-01f, 
+        7.879257202e-01f, 7.891476154e-01f, 7.903672457e-01f, 7.915844917e-01f, 7.927993536e-01f, 7.940118909e-01f, 7.952219844e-01f, 7.964297533e-01f, 
+        7.976350784e-01f, 7.988380194e-01f, 8.000385165e-01f, 8.012365699e-01f, 8.024321795e-01f, 8.036253452e-01f, 8.048160076e-01f, 8.060042262e-01f, 
+        8.071899414e-01f, 8.083731532e-01f, 8.095538616e-01f, 8.107320070e-01f, 8.119076490e-01f, 8.130807281e-01f, 8.142512441e-01f, 8.154191971e-01f, 
+        8.165845871e-01f, 8.177473545e-01f, 8.189075589e-01f, 8.200650811e-01f, 8.212200403e-01f, 8.223723173e-01f, 8.235219717e-01f, 8.246690035e-01f, 
+        8.258132935e-01f, 8.269549012e-01f, 8.280938864e-01f, 8.292301297e-01f, 8.303636312e-01f, 8.314944506e-01f, 8.326224685e-01f, 8.337478042e-01f, 
+        8.348703384e-01f, 8.359901309e-01f, 8.371071219e-01f, 8.382213116e-01f, 8.393326998e-01f, 8.404412866e-01f, 8.415470123e-01f, 8.426499367e-01f, 
+        8.437500000e-01f, 8.448472023e-01f, 8.459415436e-01f, 8.470329642e-01f, 8.481215239e-01f, 8.492071629e-01f, 8.502898812e-01f, 8.513696790e-01f, 
+        8.524465561e-01f, 8.535204530e-01f, 8.545914292e-01f, 8.556593657e-01f, 8.567243814e-01f, 8.577863574e-01f, 8.588453531e-01f, 8.599013686e-01f, 
+        8.609542847e-01f, 8.620041609e-01f, 8.630510569e-01f, 8.640948534e-01f, 8.651355505e-01f, 8.661732078e-01f, 8.672077060e-01f, 8.682391644e-01f, 
+        8.692674637e-01f, 8.702926636e-01f, 8.713147044e-01f, 8.723335862e-01f, 8.733493090e-01f, 8.743618727e-01f, 8.753712177e-01f, 8.763774037e-01f, 
+        8.773803711e-01f, 8.783801198e-01f, 8.793766499e-01f, 8.803699017e-01f, 8.813599348e-01f, 8.823466897e-01f, 8.833301663e-01f, 8.843103647e-01f, 
+        8.852872849e-01f, 8.862608671e-01f, 8.872311711e-01f, 8.881980777e-01f, 8.891617060e-01f, 8.901219368e-01f, 8.910788298e-01f, 8.920323849e-01f, 
+        8.929824829e-01f, 8.939292431e-01f, 8.948725462e-01f, 8.958123922e-01f, 8.967489004e-01f, 8.976819515e-01f, 8.986115456e-01f, 8.995375633e-01f, 
+        9.004602432e-01f, 9.013793468e-01f, 9.022949934e-01f, 9.032071829e-01f, 9.041157961e-01f, 9.050208330e-01f, 9.059224129e-01f, 9.068204165e-01f, 
+        9.077148438e-01f, 9.086056948e-01f, 9.094929695e-01f, 9.103766680e-01f, 9.112566710e-01f, 9.121330976e-01f, 9.130059481e-01f, 9.138751030e-01f, 
+        9.147405624e-01f, 9.156024456e-01f, 9.164605141e-01f, 9.173150063e-01f, 9.181658030e-01f, 9.190129042e-01f, 9.198561907e-01f, 9.206957817e-01f, 
+        9.215316772e-01f, 9.223637581e-01f, 9.231921434e-01f, 9.240167141e-01f, 9.248374701e-01f, 9.256544113e-01f, 9.264676571e-01f, 9.272769690e-01f, 
+        9.280824661e-01f, 9.288841486e-01f, 9.296818972e-01f, 9.304758310e-01f, 9.312659502e-01f, 9.320521355e-01f, 9.328343868e-01f, 9.336128235e-01f, 
+        9.343872070e-01f, 9.351576567e-01f, 9.359242916e-01f, 9.366868734e-01f, 9.374455214e-01f, 9.382002354e-01f, 9.389508963e-01f, 9.396975040e-01f, 
+        9.404401779e-01f, 9.411787987e-01f, 9.419133663e-01f, 9.426440001e-01f, 9.433704615e-01f, 9.440928698e-01f, 9.448112249e-01f, 9.455255270e-01f, 
+        9.462356567e-01f, 9.469417334e-01f, 9.476436377e-01f, 9.483413696e-01f, 9.490350485e-01f, 9.497245550e-01f, 9.504098892e-01f, 9.510909319e-01f, 
+        9.517679214e-01f, 9.524406195e-01f, 9.531091452e-01f, 9.537734985e-01f, 9.544335604e-01f, 9.550893307e-01f, 9.557409286e-01f, 9.563882351e-01f, 
+        9.570312500e-01f, 9.576699734e-01f, 9.583044052e-01f, 9.589345455e-01f, 9.595602751e-01f, 9.601817131e-01f, 9.607988596e-01f, 9.614115953e-01f, 
+        9.620199203e-01f, 9.626239538e-01f, 9.632234573e-01f, 9.638186693e-01f, 9.644094706e-01f, 9.649958611e-01f, 9.655777216e-01f, 9.661551714e-01f, 
+        9.667282104e-01f, 9.672967196e-01f, 9.678608179e-01f, 9.684203863e-01f, 9.689754248e-01f, 9.695259333e-01f, 9.700720310e-01f, 9.706134796e-01f, 
+        9.711503983e-01f, 9.716827869e-01f, 9.722105265e-01f, 9.727337360e-01f, 9.732524157e-01f, 9.737664461e-01f, 9.742758274e-01f, 9.747806787e-01f, 
+        9.752807617e-01f, 9.757761955e-01f, 9.762670994e-01f, 9.767532349e-01f, 9.772347212e-01f, 9.777115583e-01f, 9.781836271e-01f, 9.786509275e-01f, 
+        9.791135788e-01f, 9.795714617e-01f, 9.800245762e-01f, 9.804730415e-01f, 9.809166193e-01f, 9.813554287e-01f, 9.817894697e-01f, 9.822187424e-01f, 
+        9.826431274e-01f, 9.830627441e-01f, 9.834774733e-01f, 9.838873148e-01f, 9.842923880e-01f, 9.846925735e-01f, 9.850878716e-01f, 9.854781628e-01f, 
+        9.858636856e-01f, 9.862442017e-01f, 9.866198301e-01f, 9.869905710e-01f, 9.873563051e-01f, 9.877170324e-01f, 9.880728722e-01f, 9.884237051e-01f, 
+        9.887695312e-01f, 9.891103506e-01f, 9.894461632e-01f, 9.897769690e-01f, 9.901026487e-01f, 9.904233217e-01f, 9.907389879e-01f, 9.910495281e-01f, 
+        9.913549423e-01f, 9.916553497e-01f, 9.919505119e-01f, 9.922406673e-01f, 9.925256968e-01f, 9.928056002e-01f, 9.930802584e-01f, 9.933497906e-01f, 
+        9.936141968e-01f, 9.938733578e-01f, 9.941273928e-01f, 9.943761826e-01f, 9.946197271e-01f, 9.948580265e-01f, 9.950911999e-01f, 9.953190088e-01f, 
+        9.955415726e-01f, 9.957588911e-01f, 9.959708452e-01f, 9.961775541e-01f, 9.963790178e-01f, 9.965751171e-01f, 9.967658520e-01f, 9.969513416e-01f, 
+        9.971313477e-01f, 9.973059893e-01f, 9.974753857e-01f, 9.976392984e-01f, 9.977978468e-01f, 9.979510307e-01f, 9.980987310e-01f, 9.982409477e-01f, 
+        9.983778000e-01f, 9.985091686e-01f, 9.986350536e-01f, 9.987555742e-01f, 9.988704920e-01f, 9.989799261e-01f, 9.990838766e-01f, 9.991823435e-01f, 
+        9.992752075e-01f, 9.993625879e-01f, 9.994443655e-01f, 9.995205402e-01f, 9.995912313e-01f, 9.996563196e-01f, 9.997158051e-01f, 9.997695684e-01f, 
+        9.998178482e-01f, 9.998604059e-01f, 9.998973608e-01f, 9.999287128e-01f, 9.999543428e-01f, 9.999742508e-01f, 9.999885559e-01f, 9.999971390e-01f, 
+        1.000000000e+00f, 
+    },
+    // sqr
+    {
+        0.000000000e+00f, 9.536743164e-07f, 3.814697266e-06f, 8.583068848e-06f, 1.525878906e-05f, 2.384185791e-05f, 3.433227539e-05f, 4.673004150e-05f, 
+        6.103515625e-05f, 7.724761963e-05f, 9.536743164e-05f, 1.153945923e-04f, 1.373291016e-04f, 1.611709595e-04f, 1.869201660e-04f, 2.145767212e-04f, 
+        2.441406250e-04f, 2.756118774e-04f, 3.089904785e-04f, 3.442764282e-04f, 3.814697266e-04f, 4.205703735e-04f, 4.615783691e-04f, 5.044937134e-04f, 
+        5.493164062e-04f, 5.960464478e-04f, 6.446838379e-04f, 6.952285767e-04f, 7.476806641e-04f, 8.020401001e-04f, 8.583068848e-04f, 9.164810181e-04f, 
+        9.765625000e-04f, 1.038551331e-03f, 1.102447510e-03f, 1.168251038e-03f, 1.235961914e-03f, 1.305580139e-03f, 1.377105713e-03f, 1.450538635e-03f, 
+        1.525878906e-03f, 1.603126526e-03f, 1.682281494e-03f, 1.763343811e-03f, 1.846313477e-03f, 1.931190491e-03f, 2.017974854e-03f, 2.106666565e-03f, 
+        2.197265625e-03f, 2.289772034e-03f, 2.384185791e-03f, 2.480506897e-03f, 2.578735352e-03f, 2.678871155e-03f, 2.780914307e-03f, 2.884864807e-03f, 
+        2.990722656e-03f, 3.098487854e-03f, 3.208160400e-03f, 3.319740295e-03f, 3.433227539e-03f, 3.548622131e-03f, 3.665924072e-03f, 3.785133362e-03f, 
+        3.906250000e-03f, 4.029273987e-03f, 4.154205322e-03f, 4.281044006e-03f, 4.409790039e-03f, 4.540443420e-03f, 4.673004150e-03f, 4.807472229e-03f, 
+        4.943847656e-03f, 5.082130432e-03f, 5.222320557e-03f, 5.364418030e-03f, 5.508422852e-03f, 5.654335022e-03f, 5.802154541e-03f, 5.951881409e-03f, 
+        6.103515625e-03f, 6.257057190e-03f, 6.412506104e-03f, 6.569862366e-03f, 6.729125977e-03f, 6.890296936e-03f, 7.053375244e-03f, 7.218360901e-03f, 
+        7.385253906e-03f, 7.554054260e-03f, 7.724761963e-03f, 7.897377014e-03f, 8.071899414e-03f, 8.248329163e-03f, 8.426666260e-03f, 8.606910706e-03f, 
+        8.789062500e-03f, 8.973121643e-03f, 9.159088135e-03f, 9.346961975e-03f, 9.536743164e-03f, 9.728431702e-03f, 9.922027588e-03f, 1.011753082e-02f, 
+        1.031494141e-02f, 1.051425934e-02f, 1.071548462e-02f, 1.091861725e-02f, 1.112365723e-02f, 1.133060455e-02f, 1.153945923e-02f, 1.175022125e-02f, 
+        1.196289062e-02f, 1.217746735e-02f, 1.239395142e-02f, 1.261234283e-02f, 1.283264160e-02f, 1.305484772e-02f, 1.327896118e-02f, 1.350498199e-02f, 
+        1.373291016e-02f, 1.396274567e-02f, 1.419448853e-02f, 1.442813873e-02f, 1.466369629e-02f, 1.490116119e-02f, 1.514053345e-02f, 1.538181305e-02f, 
+        1.562500000e-02f, 1.587009430e-02f, 1.611709595e-02f, 1.636600494e-02f, 1.661682129e-02f, 1.686954498e-02f, 1.712417603e-02f, 1.738071442e-02f, 
+        1.763916016e-02f, 1.789951324e-02f, 1.816177368e-02f, 1.842594147e-02f, 1.869201660e-02f, 1.895999908e-02f, 1.922988892e-02f, 1.950168610e-02f, 
+        1.977539062e-02f, 2.005100250e-02f, 2.032852173e-02f, 2.060794830e-02f, 2.088928223e-02f, 2.117252350e-02f, 2.145767212e-02f, 2.174472809e-02f, 
+        2.203369141e-02f, 2.232456207e-02f, 2.261734009e-02f, 2.291202545e-02f, 2.320861816e-02f, 2.350711823e-02f, 2.380752563e-02f, 2.410984039e-02f, 
+        2.441406250e-02f, 2.472019196e-02f, 2.502822876e-02f, 2.533817291e-02f, 2.565002441e-02f, 2.596378326e-02f, 2.627944946e-02f, 2.659702301e-02f, 
+        2.691650391e-02f, 2.723789215e-02f, 2.756118774e-02f, 2.788639069e-02f, 2.821350098e-02f, 2.854251862e-02f, 2.887344360e-02f, 2.920627594e-02f, 
+        2.954101562e-02f, 2.987766266e-02f, 3.021621704e-02f, 3.055667877e-02f, 3.089904785e-02f, 3.124332428e-02f, 3.158950806e-02f, 3.193759918e-02f, 
+        3.228759766e-02f, 3.263950348e-02f, 3.299331665e-02f, 3.334903717e-02f, 3.370666504e-02f, 3.406620026e-02f, 3.442764282e-02f, 3.479099274e-02f, 
+        3.515625000e-02f, 3.552341461e-02f, 3.589248657e-02f, 3.626346588e-02f, 3.663635254e-02f, 3.701114655e-02f, 3.738784790e-02f, 3.776645660e-02f, 
+        3.814697266e-02f, 3.852939606e-02f, 3.891372681e-02f, 3.929996490e-02f, 3.968811035e-02f, 4.007816315e-02f, 4.047012329e-02f, 4.086399078e-02f, 
+        4.125976562e-02f, 4.165744781e-02f, 4.205703735e-02f, 4.245853424e-02f, 4.286193848e-02f, 4.326725006e-02f, 4.367446899e-02f, 4.408359528e-02f, 
+        4.449462891e-02f, 4.490756989e-02f, 4.532241821e-02f, 4.573917389e-02f, 4.615783691e-02f, 4.657840729e-02f, 4.700088501e-02f, 4.742527008e-02f, 
+        4.785156250e-02f, 4.827976227e-02f, 4.870986938e-02f, 4.914188385e-02f, 4.957580566e-02f, 5.001163483e-02f, 5.044937134e-02f, 5.088901520e-02f, 
+        5.133056641e-02f, 5.177402496e-02f, 5.221939087e-02f, 5.266666412e-02f, 5.311584473e-02f, 5.356693268e-02f, 5.401992798e-02f, 5.447483063e-02f, 
+        5.493164062e-02f, 5.539035797e-02f, 5.585098267e-02f, 5.631351471e-02f, 5.677795410e-02f, 5.724430084e-02f, 5.771255493e-02f, 5.818271637e-02f, 
+        5.865478516e-02f, 5.912876129e-02f, 5.960464478e-02f, 6.008243561e-02f, 6.056213379e-02f, 6.104373932e-02f, 6.152725220e-02f, 6.201267242e-02f, 
+        6.250000000e-02f, 6.298923492e-02f, 6.348037720e-02f, 6.397342682e-02f, 6.446838379e-02f, 6.496524811e-02f, 6.546401978e-02f, 6.596469879e-02f, 
+        6.646728516e-02f, 6.697177887e-02f, 6.747817993e-02f, 6.798648834e-02f, 6.849670410e-02f, 6.900882721e-02f, 6.952285767e-02f, 7.003879547e-02f, 
+        7.055664062e-02f, 7.107639313e-02f, 7.159805298e-02f, 7.212162018e-02f, 7.264709473e-02f, 7.317447662e-02f, 7.370376587e-02f, 7.423496246e-02f, 
+        7.476806641e-02f, 7.530307770e-02f, 7.583999634e-02f, 7.637882233e-02f, 7.691955566e-02f, 7.746219635e-02f, 7.800674438e-02f, 7.855319977e-02f, 
+        7.910156250e-02f, 7.965183258e-02f, 8.020401001e-02f, 8.075809479e-02f, 8.131408691e-02f, 8.187198639e-02f, 8.243179321e-02f, 8.299350739e-02f, 
+        8.355712891e-02f, 8.412265778e-02f, 8.469009399e-02f, 8.525943756e-02f, 8.583068848e-02f, 8.640384674e-02f, 8.697891235e-02f, 8.755588531e-02f, 
+        8.813476562e-02f, 8.871555328e-02f, 8.929824829e-02f, 8.988285065e-02f, 9.046936035e-02f, 9.105777740e-02f, 9.164810181e-02f, 9.224033356e-02f, 
+        9.283447266e-02f, 9.343051910e-02f, 9.402847290e-02f, 9.462833405e-02f, 9.523010254e-02f, 9.583377838e-02f, 9.643936157e-02f, 9.704685211e-02f, 
+        9.765625000e-02f, 9.826755524e-02f, 9.888076782e-02f, 9.949588776e-02f, 1.001129150e-01f, 1.007318497e-01f, 1.013526917e-01f, 1.019754410e-01f, 
+        1.026000977e-01f, 1.032266617e-01f, 1.038551331e-01f, 1.044855118e-01f, 1.051177979e-01f, 1.057519913e-01f, 1.063880920e-01f, 1.070261002e-01f, 
+        1.076660156e-01f, 1.083078384e-01f, 1.089515686e-01f, 1.095972061e-01f, 1.102447510e-01f, 1.108942032e-01f, 1.115455627e-01f, 1.121988297e-01f, 
+        1.128540039e-01f, 1.135110855e-01f, 1.141700745e-01f, 1.148309708e-01f, 1.154937744e-01f, 1.161584854e-01f, 1.168251038e-01f, 1.174936295e-01f, 
+        1.181640625e-01f, 1.188364029e-01f, 1.195106506e-01f, 1.201868057e-01f, 1.208648682e-01f, 1.215448380e-01f, 1.222267151e-01f, 1.229104996e-01f, 
+        1.235961914e-01f, 1.242837906e-01f, 1.249732971e-01f, 1.256647110e-01f, 1.263580322e-01f, 1.270532608e-01f, 1.277503967e-01f, 1.284494400e-01f, 
+        1.291503906e-01f, 1.298532486e-01f, 1.305580139e-01f, 1.312646866e-01f, 1.319732666e-01f, 1.326837540e-01f, 1.333961487e-01f, 1.341104507e-01f, 
+        1.348266602e-01f, 1.355447769e-01f, 1.362648010e-01f, 1.369867325e-01f, 1.377105713e-01f, 1.384363174e-01f, 1.391639709e-01f, 1.398935318e-01f, 
+        1.406250000e-01f, 1.413583755e-01f, 1.420936584e-01f, 1.428308487e-01f, 1.435699463e-01f, 1.443109512e-01f, 1.450538635e-01f, 1.457986832e-01f, 
+        1.465454102e-01f, 1.472940445e-01f, 1.480445862e-01f, 1.487970352e-01f, 1.495513916e-01f, 1.503076553e-01f, 1.510658264e-01f, 1.518259048e-01f, 
+        1.525878906e-01f, 1.533517838e-01f, 1.541175842e-01f, 1.548852921e-01f, 1.556549072e-01f, 1.564264297e-01f, 1.571998596e-01f, 1.579751968e-01f, 
+        1.587524414e-01f, 1.595315933e-01f, 1.603126526e-01f, 1.610956192e-01f, 1.618804932e-01f, 1.626672745e-01f, 1.634559631e-01f, 1.642465591e-01f, 
+        1.650390625e-01f, 1.658334732e-01f, 1.666297913e-01f, 1.674280167e-01f, 1.682281494e-01f, 1.690301895e-01f, 1.698341370e-01f, 1.706399918e-01f, 
+        1.714477539e-01f, 1.722574234e-01f, 1.730690002e-01f, 1.738824844e-01f, 1.746978760e-01f, 1.755151749e-01f, 1.763343811e-01f, 1.771554947e-01f, 
+        1.779785156e-01f, 1.788034439e-01f, 1.796302795e-01f, 1.804590225e-01f, 1.812896729e-01f, 1.821222305e-01f, 1.829566956e-01f, 1.837930679e-01f, 
+        1.846313477e-01f, 1.854715347e-01f, 1.863136292e-01f, 1.871576309e-01f, 1.880035400e-01f, 1.888513565e-01f, 1.897010803e-01f, 1.905527115e-01f, 
+        1.914062500e-01f, 1.922616959e-01f, 1.931190491e-01f, 1.939783096e-01f, 1.948394775e-01f, 1.957025528e-01f, 1.965675354e-01f, 1.974344254e-01f, 
+        1.983032227e-01f, 1.991739273e-01f, 2.000465393e-01f, 2.009210587e-01f, 2.017974854e-01f, 2.026758194e-01f, 2.035560608e-01f, 2.044382095e-01f, 
+        2.053222656e-01f, 2.062082291e-01f, 2.070960999e-01f, 2.079858780e-01f, 2.088775635e-01f, 2.097711563e-01f, 2.106666565e-01f, 2.115640640e-01f, 
+        2.124633789e-01f, 2.133646011e-01f, 2.142677307e-01f, 2.151727676e-01f, 2.160797119e-01f, 2.169885635e-01f, 2.178993225e-01f, 2.188119888e-01f, 
+        2.197265625e-01f, 2.206430435e-01f, 2.215614319e-01f, 2.224817276e-01f, 2.234039307e-01f, 2.243280411e-01f, 2.252540588e-01f, 2.261819839e-01f, 
+        2.271118164e-01f, 2.280435562e-01f, 2.289772034e-01f, 2.299127579e-01f, 2.308502197e-01f, 2.317895889e-01f, 2.327308655e-01f, 2.336740494e-01f, 
+        2.346191406e-01f, 2.355661392e-01f, 2.365150452e-01f, 2.374658585e-01f, 2.384185791e-01f, 2.393732071e-01f, 2.403297424e-01f, 2.412881851e-01f, 
+        2.422485352e-01f, 2.432107925e-01f, 2.441749573e-01f, 2.451410294e-01f, 2.461090088e-01f, 2.470788956e-01f, 2.480506897e-01f, 2.490243912e-01f, 
+        2.500000000e-01f, 2.509775162e-01f, 2.519569397e-01f, 2.529382706e-01f, 2.539215088e-01f, 2.549066544e-01f, 2.558937073e-01f, 2.568826675e-01f, 
+        2.578735352e-01f, 2.588663101e-01f, 2.598609924e-01f, 2.608575821e-01f, 2.618560791e-01f, 2.628564835e-01f, 2.638587952e-01f, 2.648630142e-01f, 
+        2.658691406e-01f, 2.668771744e-01f, 2.678871155e-01f, 2.688989639e-01f, 2.699127197e-01f, 2.709283829e-01f, 2.719459534e-01f, 2.729654312e-01f, 
+        2.739868164e-01f, 2.750101089e-01f, 2.760353088e-01f, 2.770624161e-01f, 2.780914307e-01f, 2.791223526e-01f, 2.801551819e-01f, 2.811899185e-01f, 
+        2.822265625e-01f, 2.832651138e-01f, 2.843055725e-01f, 2.853479385e-01f, 2.863922119e-01f, 2.874383926e-01f, 2.884864807e-01f, 2.895364761e-01f, 
+        2.905883789e-01f, 2.916421890e-01f, 2.926979065e-01f, 2.937555313e-01f, 2.948150635e-01f, 2.958765030e-01f, 2.969398499e-01f, 2.980051041e-01f, 
+        2.990722656e-01f, 3.001413345e-01f, 3.012123108e-01f, 3.022851944e-01f, 3.033599854e-01f, 3.044366837e-01f, 3.055152893e-01f, 3.065958023e-01f, 
+        3.076782227e-01f, 3.087625504e-01f, 3.098487854e-01f, 3.109369278e-01f, 3.120269775e-01f, 3.131189346e-01f, 3.142127991e-01f, 3.153085709e-01f, 
+        3.164062500e-01f, 3.175058365e-01f, 3.186073303e-01f, 3.197107315e-01f, 3.208160400e-01f, 3.219232559e-01f, 3.230323792e-01f, 3.241434097e-01f, 
+        3.252563477e-01f, 3.263711929e-01f, 3.274879456e-01f, 3.286066055e-01f, 3.297271729e-01f, 3.308496475e-01f, 3.319740295e-01f, 3.331003189e-01f, 
+        3.342285156e-01f, 3.353586197e-01f, 3.364906311e-01f, 3.376245499e-01f, 3.387603760e-01f, 3.398981094e-01f, 3.410377502e-01f, 3.421792984e-01f, 
+        3.433227539e-01f, 3.444681168e-01f, 3.456153870e-01f, 3.467645645e-01f, 3.479156494e-01f, 3.490686417e-01f, 3.502235413e-01f, 3.513803482e-01f, 
+        3.525390625e-01f, 3.536996841e-01f, 3.548622131e-01f, 3.560266495e-01f, 3.571929932e-01f, 3.583612442e-01f, 3.595314026e-01f, 3.607034683e-01f, 
+        3.618774414e-01f, 3.630533218e-01f, 3.642311096e-01f, 3.654108047e-01f, 3.665924072e-01f, 3.677759171e-01f, 3.689613342e-01f, 3.701486588e-01f, 
+        3.713378906e-01f, 3.725290298e-01f, 3.737220764e-01f, 3.749170303e-01f, 3.761138916e-01f, 3.773126602e-01f, 3.785133362e-01f, 3.797159195e-01f, 
+        3.809204102e-01f, 3.821268082e-01f, 3.833351135e-01f, 3.845453262e-01f, 3.857574463e-01f, 3.869714737e-01f, 3.881874084e-01f, 3.894052505e-01f, 
+        3.906250000e-01f, 3.918466568e-01f, 3.930702209e-01f, 3.942956924e-01f, 3.955230713e-01f, 3.967523575e-01f, 3.979835510e-01f, 3.992166519e-01f, 
+        4.004516602e-01f, 4.016885757e-01f, 4.029273987e-01f, 4.041681290e-01f, 4.054107666e-01f, 4.066553116e-01f, 4.079017639e-01f, 4.091501236e-01f, 
+        4.104003906e-01f, 4.116525650e-01f, 4.129066467e-01f, 4.141626358e-01f, 4.154205322e-01f, 4.166803360e-01f, 4.179420471e-01f, 4.192056656e-01f, 
+        4.204711914e-01f, 4.217386246e-01f, 4.230079651e-01f, 4.242792130e-01f, 4.255523682e-01f, 4.268274307e-01f, 4.281044006e-01f, 4.293832779e-01f, 
+        4.306640625e-01f, 4.319467545e-01f, 4.332313538e-01f, 4.345178604e-01f, 4.358062744e-01f, 4.370965958e-01f, 4.383888245e-01f, 4.396829605e-01f, 
+        4.409790039e-01f, 4.422769547e-01f, 4.435768127e-01f, 4.448785782e-01f, 4.461822510e-01f, 4.474878311e-01f, 4.487953186e-01f, 4.501047134e-01f, 
+        4.514160156e-01f, 4.527292252e-01f, 4.540443420e-01f, 4.553613663e-01f, 4.566802979e-01f, 4.580011368e-01f, 4.593238831e-01f, 4.606485367e-01f, 
+        4.619750977e-01f, 4.633035660e-01f, 4.646339417e-01f, 4.659662247e-01f, 4.673004150e-01f, 4.686365128e-01f, 4.699745178e-01f, 4.713144302e-01f, 
+        4.726562500e-01f, 4.739999771e-01f, 4.753456116e-01f, 4.766931534e-01f, 4.780426025e-01f, 4.793939590e-01f, 4.807472229e-01f, 4.821023941e-01f, 
+        4.834594727e-01f, 4.848184586e-01f, 4.861793518e-01f, 4.875421524e-01f, 4.889068604e-01f, 4.902734756e-01f, 4.916419983e-01f, 4.930124283e-01f, 
+        4.943847656e-01f, 4.957590103e-01f, 4.971351624e-01f, 4.985132217e-01f, 4.998931885e-01f, 5.012750626e-01f, 5.026588440e-01f, 5.040445328e-01f, 
+        5.054321289e-01f, 5.068216324e-01f, 5.082130432e-01f, 5.096063614e-01f, 5.110015869e-01f, 5.123987198e-01f, 5.137977600e-01f, 5.151987076e-01f, 
+        5.166015625e-01f, 5.180063248e-01f, 5.194129944e-01f, 5.208215714e-01f, 5.222320557e-01f, 5.236444473e-01f, 5.250587463e-01f, 5.264749527e-01f, 
+        5.278930664e-01f, 5.293130875e-01f, 5.307350159e-01f, 5.321588516e-01f, 5.335845947e-01f, 5.350122452e-01f, 5.364418030e-01f, 5.378732681e-01f, 
+        5.393066406e-01f, 5.407419205e-01f, 5.421791077e-01f, 5.436182022e-01f, 5.450592041e-01f, 5.465021133e-01f, 5.479469299e-01f, 5.493936539e-01f, 
+        5.508422852e-01f, 5.522928238e-01f, 5.537452698e-01f, 5.551996231e-01f, 5.566558838e-01f, 5.581140518e-01f, 5.595741272e-01f, 5.610361099e-01f, 
+        5.625000000e-01f, 5.639657974e-01f, 5.654335022e-01f, 5.669031143e-01f, 5.683746338e-01f, 5.698480606e-01f, 5.713233948e-01f, 5.728006363e-01f, 
+        5.742797852e-01f, 5.757608414e-01f, 5.772438049e-01f, 5.787286758e-01f, 5.802154541e-01f, 5.817041397e-01f, 5.831947327e-01f, 5.846872330e-01f, 
+        5.861816406e-01f, 5.876779556e-01f, 5.891761780e-01f, 5.906763077e-01f, 5.921783447e-01f, 5.936822891e-01f, 5.951881409e-01f, 5.966959000e-01f, 
+        5.982055664e-01f, 5.997171402e-01f, 6.012306213e-01f, 6.027460098e-01f, 6.042633057e-01f, 6.057825089e-01f, 6.073036194e-01f, 6.088266373e-01f, 
+        6.103515625e-01f, 6.118783951e-01f, 6.134071350e-01f, 6.149377823e-01f, 6.164703369e-01f, 6.180047989e-01f, 6.195411682e-01f, 6.210794449e-01f, 
+        6.226196289e-01f, 6.241617203e-01f, 6.257057190e-01f, 6.272516251e-01f, 6.287994385e-01f, 6.303491592e-01f, 6.319007874e-01f, 6.334543228e-01f, 
+        6.350097656e-01f, 6.365671158e-01f, 6.381263733e-01f, 6.396875381e-01f, 6.412506104e-01f, 6.428155899e-01f, 6.443824768e-01f, 6.459512711e-01f, 
+        6.475219727e-01f, 6.490945816e-01f, 6.506690979e-01f, 6.522455215e-01f, 6.538238525e-01f, 6.554040909e-01f, 6.569862366e-01f, 6.585702896e-01f, 
+        6.601562500e-01f, 6.617441177e-01f, 6.633338928e-01f, 6.649255753e-01f, 6.665191650e-01f, 6.681146622e-01f, 6.697120667e-01f, 6.713113785e-01f, 
+        6.729125977e-01f, 6.745157242e-01f, 6.761207581e-01f, 6.777276993e-01f, 6.793365479e-01f, 6.809473038e-01f, 6.825599670e-01f, 6.841745377e-01f, 
+        6.857910156e-01f, 6.874094009e-01f, 6.890296936e-01f, 6.906518936e-01f, 6.922760010e-01f, 6.939020157e-01f, 6.955299377e-01f, 6.971597672e-01f, 
+        6.987915039e-01f, 7.004251480e-01f, 7.020606995e-01f, 7.036981583e-01f, 7.053375244e-01f, 7.069787979e-01f, 7.086219788e-01f, 7.102670670e-01f, 
+        7.119140625e-01f, 7.135629654e-01f, 7.152137756e-01f, 7.168664932e-01f, 7.185211182e-01f, 7.201776505e-01f, 7.218360901e-01f, 7.234964371e-01f, 
+        7.251586914e-01f, 7.268228531e-01f, 7.284889221e-01f, 7.301568985e-01f, 7.318267822e-01f, 7.334985733e-01f, 7.351722717e-01f, 7.368478775e-01f, 
+        7.385253906e-01f, 7.402048111e-01f, 7.418861389e-01f, 7.435693741e-01f, 7.452545166e-01f, 7.469415665e-01f, 7.486305237e-01f, 7.503213882e-01f, 
+        7.520141602e-01f, 7.537088394e-01f, 7.554054260e-01f, 7.571039200e-01f, 7.588043213e-01f, 7.605066299e-01f, 7.622108459e-01f, 7.639169693e-01f, 
+        7.656250000e-01f, 7.673349380e-01f, 7.690467834e-01f, 7.707605362e-01f, 7.724761963e-01f, 7.741937637e-01f, 7.759132385e-01f, 7.776346207e-01f, 
+        7.793579102e-01f, 7.810831070e-01f, 7.828102112e-01f, 7.845392227e-01f, 7.862701416e-01f, 7.880029678e-01f, 7.897377014e-01f, 7.914743423e-01f, 
+        7.932128906e-01f, 7.949533463e-01f, 7.966957092e-01f, 7.984399796e-01f, 8.001861572e-01f, 8.019342422e-01f, 8.036842346e-01f, 8.054361343e-01f, 
+        8.071899414e-01f, 8.089456558e-01f, 8.107032776e-01f, 8.124628067e-01f, 8.142242432e-01f, 8.159875870e-01f, 8.177528381e-01f, 8.195199966e-01f, 
+        8.212890625e-01f, 8.230600357e-01f, 8.248329163e-01f, 8.266077042e-01f, 8.283843994e-01f, 8.301630020e-01f, 8.319435120e-01f, 8.337259293e-01f, 
+        8.355102539e-01f, 8.372964859e-01f, 8.390846252e-01f, 8.408746719e-01f, 8.426666260e-01f, 8.444604874e-01f, 8.462562561e-01f, 8.480539322e-01f, 
+        8.498535156e-01f, 8.516550064e-01f, 8.534584045e-01f, 8.552637100e-01f, 8.570709229e-01f, 8.588800430e-01f, 8.606910706e-01f, 8.625040054e-01f, 
+        8.643188477e-01f, 8.661355972e-01f, 8.679542542e-01f, 8.697748184e-01f, 8.715972900e-01f, 8.734216690e-01f, 8.752479553e-01f, 8.770761490e-01f, 
+        8.789062500e-01f, 8.807382584e-01f, 8.825721741e-01f, 8.844079971e-01f, 8.862457275e-01f, 8.880853653e-01f, 8.899269104e-01f, 8.917703629e-01f, 
+        8.936157227e-01f, 8.954629898e-01f, 8.973121643e-01f, 8.991632462e-01f, 9.010162354e-01f, 9.028711319e-01f, 9.047279358e-01f, 9.065866470e-01f, 
+        9.084472656e-01f, 9.103097916e-01f, 9.121742249e-01f, 9.140405655e-01f, 9.159088135e-01f, 9.177789688e-01f, 9.196510315e-01f, 9.215250015e-01f, 
+        9.234008789e-01f, 9.252786636e-01f, 9.271583557e-01f, 9.290399551e-01f, 9.309234619e-01f, 9.328088760e-01f, 9.346961975e-01f, 9.365854263e-01f, 
+        9.384765625e-01f, 9.403696060e-01f, 9.422645569e-01f, 9.441614151e-01f, 9.460601807e-01f, 9.479608536e-01f, 9.498634338e-01f, 9.517679214e-01f, 
+        9.536743164e-01f, 9.555826187e-01f, 9.574928284e-01f, 9.594049454e-01f, 9.613189697e-01f, 9.632349014e-01f, 9.651527405e-01f, 9.670724869e-01f, 
+        9.689941406e-01f, 9.709177017e-01f, 9.728431702e-01f, 9.747705460e-01f, 9.766998291e-01f, 9.786310196e-01f, 9.805641174e-01f, 9.824991226e-01f, 
+        9.844360352e-01f, 9.863748550e-01f, 9.883155823e-01f, 9.902582169e-01f, 9.922027588e-01f, 9.941492081e-01f, 9.960975647e-01f, 9.980478287e-01f, 
+        1.000000000e+00f, 
+    },
+    // sqrt
+    {
+        0.000000000e+00f, 3.125000000e-02f, 4.419417307e-02f, 5.412658677e-02f, 6.250000000e-02f, 6.987712532e-02f, 7.654655725e-02f, 8.267972618e-02f, 
+        8.838834614e-02f, 9.375000000e-02f, 9.882117808e-02f, 1.036445275e-01f, 1.082531735e-01f, 1.126734763e-01f, 1.169267967e-01f, 1.210307330e-01f, 
+        1.250000000e-01f, 1.288470477e-01f, 1.325825155e-01f, 1.362155974e-01f, 1.397542506e-01f, 1.432054937e-01f, 1.465754956e-01f, 1.498697400e-01f, 
+        1.530931145e-01f, 1.562500000e-01f, 1.593443602e-01f, 1.623797566e-01f, 1.653594524e-01f, 1.682863981e-01f, 1.711633056e-01f, 1.739926338e-01f, 
+        1.767766923e-01f, 1.795175821e-01f, 1.822172403e-01f, 1.848774999e-01f, 1.875000000e-01f, 1.900863349e-01f, 1.926379353e-01f, 1.951561868e-01f, 
+        1.976423562e-01f, 2.000976354e-01f, 2.025231421e-01f, 2.049199492e-01f, 2.072890550e-01f, 2.096313685e-01f, 2.119478136e-01f, 2.142392099e-01f, 
+        2.165063471e-01f, 2.187500000e-01f, 2.209708691e-01f, 2.231696397e-01f, 2.253469527e-01f, 2.275034338e-01f, 2.296396643e-01f, 2.317561954e-01f, 
+        2.338535935e-01f, 2.359323204e-01f, 2.379929125e-01f, 2.400358021e-01f, 2.420614660e-01f, 2.440703064e-01f, 2.460627407e-01f, 2.480391860e-01f, 
+        2.500000000e-01f, 2.519455552e-01f, 2.538762093e-01f, 2.557922602e-01f, 2.576940954e-01f, 2.595819831e-01f, 2.614562511e-01f, 2.633171678e-01f, 
+        2.651650310e-01f, 2.670001090e-01f, 2.688226700e-01f, 2.706329525e-01f, 2.724311948e-01f, 2.742176354e-01f, 2.759925127e-01f, 2.777560651e-01f, 
+        2.795085013e-01f, 2.812500000e-01f, 2.829807997e-01f, 2.847010493e-01f, 2.864109874e-01f, 2.881107628e-01f, 2.898005843e-01f, 2.914806008e-01f, 
+        2.931509912e-01f, 2.948119044e-01f, 2.964635193e-01f, 2.981060147e-01f, 2.997394800e-01f, 3.013640940e-01f, 3.029800057e-01f, 3.045873344e-01f, 
+        3.061862290e-01f, 3.077768087e-01f, 3.093592227e-01f, 3.109335601e-01f, 3.125000000e-01f, 3.140586019e-01f, 3.156095147e-01f, 3.171528578e-01f, 
+        3.186887205e-01f, 3.202172220e-01f, 3.217384517e-01f, 3.232524991e-01f, 3.247595131e-01f, 3.262595832e-01f, 3.277527690e-01f, 3.292391896e-01f, 
+        3.307189047e-01f, 3.321920633e-01f, 3.336586952e-01f, 3.351189196e-01f, 3.365727961e-01f, 3.380204439e-01f, 3.394618928e-01f, 3.408972621e-01f, 
+        3.423266113e-01f, 3.437500000e-01f, 3.451675177e-01f, 3.465792537e-01f, 3.479852676e-01f, 3.493856192e-01f, 3.507803679e-01f, 3.521696031e-01f, 
+        3.535533845e-01f, 3.549317718e-01f, 3.563048244e-01f, 3.576726019e-01f, 3.590351641e-01f, 3.603925705e-01f, 3.617449105e-01f, 3.630921841e-01f, 
+        3.644344807e-01f, 3.657718599e-01f, 3.671043813e-01f, 3.684320748e-01f, 3.697549999e-01f, 3.710731864e-01f, 3.723867238e-01f, 3.736956418e-01f, 
+        3.750000000e-01f, 3.762998283e-01f, 3.775951862e-01f, 3.788861036e-01f, 3.801726699e-01f, 3.814548552e-01f, 3.827327788e-01f, 3.840064406e-01f, 
+        3.852758706e-01f, 3.865411580e-01f, 3.878023028e-01f, 3.890593648e-01f, 3.903123736e-01f, 3.915613890e-01f, 3.928064108e-01f, 3.940474987e-01f, 
+        3.952847123e-01f, 3.965180516e-01f, 3.977475762e-01f, 3.989732862e-01f, 4.001952708e-01f, 4.014135301e-01f, 4.026280940e-01f, 4.038389921e-01f, 
+        4.050462842e-01f, 4.062500000e-01f, 4.074501395e-01f, 4.086467624e-01f, 4.098398983e-01f, 4.110295773e-01f, 4.122157991e-01f, 4.133986533e-01f, 
+        4.145781100e-01f, 4.157541990e-01f, 4.169270098e-01f, 4.180965126e-01f, 4.192627370e-01f, 4.204257429e-01f, 4.215855598e-01f, 4.227421582e-01f, 
+        4.238956273e-01f, 4.250459671e-01f, 4.261931777e-01f, 4.273373187e-01f, 4.284784198e-01f, 4.296164811e-01f, 4.307515323e-01f, 4.318836033e-01f, 
+        4.330126941e-01f, 4.341388643e-01f, 4.352621436e-01f, 4.363825023e-01f, 4.375000000e-01f, 4.386146367e-01f, 4.397264719e-01f, 4.408355057e-01f, 
+        4.419417381e-01f, 4.430452287e-01f, 4.441459477e-01f, 4.452439547e-01f, 4.463392794e-01f, 4.474319220e-01f, 4.485218823e-01f, 4.496092200e-01f, 
+        4.506939054e-01f, 4.517759979e-01f, 4.528555274e-01f, 4.539324641e-01f, 4.550068676e-01f, 4.560787380e-01f, 4.571480751e-01f, 4.582149386e-01f, 
+        4.592793286e-01f, 4.603412449e-01f, 4.614007175e-01f, 4.624577761e-01f, 4.635123909e-01f, 4.645646513e-01f, 4.656145275e-01f, 4.666620195e-01f, 
+        4.677071869e-01f, 4.687500000e-01f, 4.697905183e-01f, 4.708287120e-01f, 4.718646407e-01f, 4.728983045e-01f, 4.739297032e-01f, 4.749588668e-01f, 
+        4.759858251e-01f, 4.770105481e-01f, 4.780330658e-01f, 4.790534377e-01f, 4.800716043e-01f, 4.810876250e-01f, 4.821015298e-01f, 4.831132889e-01f, 
+        4.841229320e-01f, 4.851304591e-01f, 4.861359000e-01f, 4.871392846e-01f, 4.881406128e-01f, 4.891398847e-01f, 4.901371002e-01f, 4.911322892e-01f, 
+        4.921254814e-01f, 4.931166768e-01f, 4.941058755e-01f, 4.950931072e-01f, 4.960783720e-01f, 4.970616698e-01f, 4.980430305e-01f, 4.990224838e-01f, 
+        5.000000000e-01f, 5.009756088e-01f, 5.019493103e-01f, 5.029211640e-01f, 5.038911104e-01f, 5.048592091e-01f, 5.058254600e-01f, 5.067898631e-01f, 
+        5.077524185e-01f, 5.087131262e-01f, 5.096721053e-01f, 5.106292367e-01f, 5.115845203e-01f, 5.125381351e-01f, 5.134899020e-01f, 5.144399405e-01f, 
+        5.153881907e-01f, 5.163347125e-01f, 5.172795653e-01f, 5.182226300e-01f, 5.191639662e-01f, 5.201036334e-01f, 5.210416317e-01f, 5.219779015e-01f, 
+        5.229125023e-01f, 5.238454342e-01f, 5.247767568e-01f, 5.257063508e-01f, 5.266343355e-01f, 5.275607109e-01f, 5.284854770e-01f, 5.294085741e-01f, 
+        5.303300619e-01f, 5.312500000e-01f, 5.321683288e-01f, 5.330850482e-01f, 5.340002179e-01f, 5.349138379e-01f, 5.358259082e-01f, 5.367363691e-01f, 
+        5.376453400e-01f, 5.385527611e-01f, 5.394586325e-01f, 5.403630137e-01f, 5.412659049e-01f, 5.421672463e-01f, 5.430670977e-01f, 5.439654589e-01f, 
+        5.448623896e-01f, 5.457577705e-01f, 5.466517210e-01f, 5.475442410e-01f, 5.484352708e-01f, 5.493248701e-01f, 5.502130389e-01f, 5.510997772e-01f, 
+        5.519850254e-01f, 5.528689623e-01f, 5.537514091e-01f, 5.546324849e-01f, 5.555121303e-01f, 5.563904047e-01f, 5.572673082e-01f, 5.581428409e-01f, 
+        5.590170026e-01f, 5.598897934e-01f, 5.607612133e-01f, 5.616312623e-01f, 5.625000000e-01f, 5.633673668e-01f, 5.642334223e-01f, 5.650981665e-01f, 
+        5.659615993e-01f, 5.668236613e-01f, 5.676844120e-01f, 5.685439110e-01f, 5.694020987e-01f, 5.702589750e-01f, 5.711145997e-01f, 5.719689131e-01f, 
+        5.728219748e-01f, 5.736737251e-01f, 5.745242834e-01f, 5.753735304e-01f, 5.762215257e-01f, 5.770682693e-01f, 5.779138207e-01f, 5.787581205e-01f, 
+        5.796011686e-01f, 5.804429650e-01f, 5.812836289e-01f, 5.821229815e-01f, 5.829612017e-01f, 5.837981701e-01f, 5.846339464e-01f, 5.854685903e-01f, 
+        5.863019824e-01f, 5.871341825e-01f, 5.879652500e-01f, 5.887951255e-01f, 5.896238089e-01f, 5.904513597e-01f, 5.912777185e-01f, 5.921030045e-01f, 
+        5.929270387e-01f, 5.937500000e-01f, 5.945718288e-01f, 5.953924656e-01f, 5.962120295e-01f, 5.970304012e-01f, 5.978477001e-01f, 5.986638665e-01f, 
+        5.994789600e-01f, 6.002929211e-01f, 6.011057496e-01f, 6.019175053e-01f, 6.027281880e-01f, 6.035377383e-01f, 6.043462157e-01f, 6.051536202e-01f, 
+        6.059600115e-01f, 6.067652702e-01f, 6.075694561e-01f, 6.083725691e-01f, 6.091746688e-01f, 6.099756360e-01f, 6.107756495e-01f, 6.115745306e-01f, 
+        6.123724580e-01f, 6.131692529e-01f, 6.139650941e-01f, 6.147598624e-01f, 6.155536175e-01f, 6.163463593e-01f, 6.171380281e-01f, 6.179287434e-01f, 
+        6.187184453e-01f, 6.195071340e-01f, 6.202948093e-01f, 6.210814714e-01f, 6.218671203e-01f, 6.226518154e-01f, 6.234355569e-01f, 6.242182851e-01f, 
+        6.250000000e-01f, 6.257807612e-01f, 6.265605688e-01f, 6.273393631e-01f, 6.281172037e-01f, 6.288940907e-01f, 6.296700239e-01f, 6.304450035e-01f, 
+        6.312190294e-01f, 6.319921613e-01f, 6.327642798e-01f, 6.335354447e-01f, 6.343057156e-01f, 6.350750327e-01f, 6.358434558e-01f, 6.366109252e-01f, 
+        6.373774409e-01f, 6.381430626e-01f, 6.389077306e-01f, 6.396715641e-01f, 6.404344440e-01f, 6.411963701e-01f, 6.419574618e-01f, 6.427175999e-01f, 
+        6.434769034e-01f, 6.442352533e-01f, 6.449927092e-01f, 6.457493305e-01f, 6.465049982e-01f, 6.472598314e-01f, 6.480137706e-01f, 6.487668753e-01f, 
+        6.495190263e-01f, 6.502704024e-01f, 6.510208249e-01f, 6.517704129e-01f, 6.525191665e-01f, 6.532670259e-01f, 6.540140510e-01f, 6.547602415e-01f, 
+        6.555055380e-01f, 6.562500000e-01f, 6.569936275e-01f, 6.577364206e-01f, 6.584783792e-01f, 6.592194438e-01f, 6.599597335e-01f, 6.606991887e-01f, 
+        6.614378095e-01f, 6.621756554e-01f, 6.629126072e-01f, 6.636487842e-01f, 6.643841267e-01f, 6.651186347e-01f, 6.658523679e-01f, 6.665852666e-01f, 
+        6.673173904e-01f, 6.680486798e-01f, 6.687791944e-01f, 6.695089340e-01f, 6.702378392e-01f, 6.709659696e-01f, 6.716932654e-01f, 6.724198461e-01f, 
+        6.731455922e-01f, 6.738705635e-01f, 6.745947599e-01f, 6.753182411e-01f, 6.760408878e-01f, 6.767627597e-01f, 6.774838567e-01f, 6.782041788e-01f, 
+        6.789237857e-01f, 6.796426177e-01f, 6.803606749e-01f, 6.810779572e-01f, 6.817945242e-01f, 6.825103164e-01f, 6.832253337e-01f, 6.839396358e-01f, 
+        6.846532226e-01f, 6.853660345e-01f, 6.860780716e-01f, 6.867893934e-01f, 6.875000000e-01f, 6.882098317e-01f, 6.889190078e-01f, 6.896274090e-01f, 
+        6.903350353e-01f, 6.910420060e-01f, 6.917482615e-01f, 6.924537420e-01f, 6.931585073e-01f, 6.938626170e-01f, 6.945659518e-01f, 6.952686310e-01f, 
+        6.959705353e-01f, 6.966717839e-01f, 6.973723173e-01f, 6.980721354e-01f, 6.987712383e-01f, 6.994696856e-01f, 7.001674175e-01f, 7.008644342e-01f, 
+        7.015607357e-01f, 7.022563815e-01f, 7.029513717e-01f, 7.036456466e-01f, 7.043392062e-01f, 7.050321102e-01f, 7.057243586e-01f, 7.064158916e-01f, 
+        7.071067691e-01f, 7.077969909e-01f, 7.084864974e-01f, 7.091753483e-01f, 7.098635435e-01f, 7.105510831e-01f, 7.112379074e-01f, 7.119241357e-01f, 
+        7.126096487e-01f, 7.132945061e-01f, 7.139787078e-01f, 7.146623135e-01f, 7.153452039e-01f, 7.160274386e-01f, 7.167090774e-01f, 7.173900008e-01f, 
+        7.180703282e-01f, 7.187500000e-01f, 7.194290161e-01f, 7.201074362e-01f, 7.207851410e-01f, 7.214622498e-01f, 7.221387625e-01f, 7.228146195e-01f, 
+        7.234898210e-01f, 7.241643667e-01f, 7.248383164e-01f, 7.255116701e-01f, 7.261843681e-01f, 7.268564701e-01f, 7.275279164e-01f, 7.281987667e-01f, 
+        7.288689613e-01f, 7.295386195e-01f, 7.302075624e-01f, 7.308759689e-01f, 7.315437198e-01f, 7.322109342e-01f, 7.328774333e-01f, 7.335433960e-01f, 
+        7.342087626e-01f, 7.348734736e-01f, 7.355376482e-01f, 7.362011671e-01f, 7.368641496e-01f, 7.375264764e-01f, 7.381882668e-01f, 7.388494015e-01f, 
+        7.395099998e-01f, 7.401699424e-01f, 7.408293486e-01f, 7.414881587e-01f, 7.421463728e-01f, 7.428039908e-01f, 7.434610724e-01f, 7.441175580e-01f, 
+        7.447734475e-01f, 7.454288006e-01f, 7.460834980e-01f, 7.467377186e-01f, 7.473912835e-01f, 7.480443120e-01f, 7.486968040e-01f, 7.493487000e-01f, 
+        7.500000000e-01f, 7.506507635e-01f, 7.513009310e-01f, 7.519505620e-01f, 7.525996566e-01f, 7.532481551e-01f, 7.538961172e-01f, 7.545435429e-01f, 
+        7.551903725e-01f, 7.558366656e-01f, 7.564824224e-01f, 7.571275830e-01f, 7.577722073e-01f, 7.584162951e-01f, 7.590598464e-01f, 7.597028613e-01f, 
+        7.603453398e-01f, 7.609872222e-01f, 7.616286278e-01f, 7.622694373e-01f, 7.629097104e-01f, 7.635495067e-01f, 7.641887069e-01f, 7.648273706e-01f, 
+        7.654655576e-01f, 7.661031485e-01f, 7.667402625e-01f, 7.673768401e-01f, 7.680128813e-01f, 7.686483860e-01f, 7.692833543e-01f, 7.699177861e-01f, 
+        7.705517411e-01f, 7.711851597e-01f, 7.718180418e-01f, 7.724504471e-01f, 7.730823159e-01f, 7.737136483e-01f, 7.743445039e-01f, 7.749748230e-01f, 
+        7.756046057e-01f, 7.762339115e-01f, 7.768626809e-01f, 7.774909735e-01f, 7.781187296e-01f, 7.787460089e-01f, 7.793727517e-01f, 7.799990177e-01f, 
+        7.806247473e-01f, 7.812500000e-01f, 7.818747759e-01f, 7.824990153e-01f, 7.831227779e-01f, 7.837460041e-01f, 7.843687534e-01f, 7.849910259e-01f, 
+        7.856128216e-01f, 7.862340808e-01f, 7.868549228e-01f, 7.874751687e-01f, 7.880949974e-01f, 7.887143493e-01f, 7.893331647e-01f, 7.899515629e-01f, 
+        7.905694246e-01f, 7.911868095e-01f, 7.918037176e-01f, 7.924201488e-01f, 7.930361032e-01f, 7.936515808e-01f, 7.942665815e-01f, 7.948811054e-01f, 
+        7.954951525e-01f, 7.961087227e-01f, 7.967218161e-01f, 7.973344326e-01f, 7.979465723e-01f, 7.985582948e-01f, 7.991694808e-01f, 7.997802496e-01f, 
+        8.003905416e-01f, 8.010003567e-01f, 8.016096950e-01f, 8.022186160e-01f, 8.028270602e-01f, 8.034350276e-01f, 8.040425181e-01f, 8.046495914e-01f, 
+        8.052561879e-01f, 8.058623075e-01f, 8.064680099e-01f, 8.070732355e-01f, 8.076779842e-01f, 8.082823157e-01f, 8.088861704e-01f, 8.094896078e-01f, 
+        8.100925684e-01f, 8.106951118e-01f, 8.112971783e-01f, 8.118988276e-01f, 8.125000000e-01f, 8.131007552e-01f, 8.137010336e-01f, 8.143008947e-01f, 
+        8.149002790e-01f, 8.154992461e-01f, 8.160977960e-01f, 8.166958690e-01f, 8.172935247e-01f, 8.178907633e-01f, 8.184875250e-01f, 8.190839291e-01f, 
+        8.196797967e-01f, 8.202753067e-01f, 8.208703399e-01f, 8.214649558e-01f, 8.220591545e-01f, 8.226529360e-01f, 8.232462406e-01f, 8.238391280e-01f, 
+        8.244315982e-01f, 8.250236511e-01f, 8.256152868e-01f, 8.262065053e-01f, 8.267973065e-01f, 8.273876309e-01f, 8.279775977e-01f, 8.285670877e-01f, 
+        8.291562200e-01f, 8.297448754e-01f, 8.303331137e-01f, 8.309209943e-01f, 8.315083981e-01f, 8.320954442e-01f, 8.326820135e-01f, 8.332682252e-01f, 
+        8.338540196e-01f, 8.344393969e-01f, 8.350242972e-01f, 8.356088996e-01f, 8.361930251e-01f, 8.367767334e-01f, 8.373600841e-01f, 8.379429579e-01f, 
+        8.385254741e-01f, 8.391075730e-01f, 8.396893144e-01f, 8.402705789e-01f, 8.408514857e-01f, 8.414319754e-01f, 8.420121074e-01f, 8.425918221e-01f, 
+        8.431711197e-01f, 8.437500000e-01f, 8.443285227e-01f, 8.449066281e-01f, 8.454843163e-01f, 8.460616469e-01f, 8.466385603e-01f, 8.472151160e-01f, 
+        8.477912545e-01f, 8.483669758e-01f, 8.489423394e-01f, 8.495173454e-01f, 8.500919342e-01f, 8.506661057e-01f, 8.512399197e-01f, 8.518133163e-01f, 
+        8.523863554e-01f, 8.529589772e-01f, 8.535312414e-01f, 8.541031480e-01f, 8.546746373e-01f, 8.552457690e-01f, 8.558164835e-01f, 8.563868403e-01f, 
+        8.569568396e-01f, 8.575264215e-01f, 8.580956459e-01f, 8.586644530e-01f, 8.592329621e-01f, 8.598010540e-01f, 8.603687286e-01f, 8.609361053e-01f, 
+        8.615030646e-01f, 8.620696664e-01f, 8.626358509e-01f, 8.632016778e-01f, 8.637672067e-01f, 8.643323183e-01f, 8.648970127e-01f, 8.654614091e-01f, 
+        8.660253882e-01f, 8.665890098e-01f, 8.671523333e-01f, 8.677152395e-01f, 8.682777286e-01f, 8.688399196e-01f, 8.694017529e-01f, 8.699631691e-01f, 
+        8.705242872e-01f, 8.710849881e-01f, 8.716453314e-01f, 8.722053766e-01f, 8.727650046e-01f, 8.733242750e-01f, 8.738831878e-01f, 8.744418025e-01f, 
+        8.750000000e-01f, 8.755578399e-01f, 8.761153817e-01f, 8.766725063e-01f, 8.772292733e-01f, 8.777857423e-01f, 8.783418536e-01f, 8.788975477e-01f, 
+        8.794529438e-01f, 8.800079823e-01f, 8.805626631e-01f, 8.811169863e-01f, 8.816710114e-01f, 8.822246194e-01f, 8.827779293e-01f, 8.833308816e-01f, 
+        8.838834763e-01f, 8.844357133e-01f, 8.849876523e-01f, 8.855392337e-01f, 8.860904574e-01f, 8.866413236e-01f, 8.871918321e-01f, 8.877420425e-01f, 
+        8.882918954e-01f, 8.888413906e-01f, 8.893905878e-01f, 8.899394274e-01f, 8.904879093e-01f, 8.910360932e-01f, 8.915839195e-01f, 8.921313882e-01f, 
+        8.926785588e-01f, 8.932253718e-01f, 8.937718272e-01f, 8.943179846e-01f, 8.948638439e-01f, 8.954092860e-01f, 8.959544301e-01f, 8.964992762e-01f, 
+        8.970437646e-01f, 8.975878954e-01f, 8.981317282e-01f, 8.986752629e-01f, 8.992184401e-01f, 8.997612596e-01f, 9.003037810e-01f, 9.008459449e-01f, 
+        9.013878107e-01f, 9.019293785e-01f, 9.024705887e-01f, 9.030114412e-01f, 9.035519958e-01f, 9.040922523e-01f, 9.046321511e-01f, 9.051717520e-01f, 
+        9.057110548e-01f, 9.062500000e-01f, 9.067886472e-01f, 9.073269367e-01f, 9.078649282e-01f, 9.084026217e-01f, 9.089399576e-01f, 9.094769955e-01f, 
+        9.100137353e-01f, 9.105501175e-01f, 9.110862613e-01f, 9.116219878e-01f, 9.121574759e-01f, 9.126926064e-01f, 9.132274389e-01f, 9.137619734e-01f, 
+        9.142961502e-01f, 9.148300886e-01f, 9.153636694e-01f, 9.158969522e-01f, 9.164298773e-01f, 9.169625640e-01f, 9.174948931e-01f, 9.180269241e-01f, 
+        9.185586572e-01f, 9.190900922e-01f, 9.196211696e-01f, 9.201520085e-01f, 9.206824899e-01f, 9.212126732e-01f, 9.217425585e-01f, 9.222721457e-01f, 
+        9.228014350e-01f, 9.233304262e-01f, 9.238591194e-01f, 9.243874550e-01f, 9.249155521e-01f, 9.254432917e-01f, 9.259707928e-01f, 9.264979362e-01f, 
+        9.270247817e-01f, 9.275513887e-01f, 9.280776381e-01f, 9.286036491e-01f, 9.291293025e-01f, 9.296546578e-01f, 9.301797748e-01f, 9.307045341e-01f, 
+        9.312290549e-01f, 9.317532182e-01f, 9.322771430e-01f, 9.328007102e-01f, 9.333240390e-01f, 9.338470697e-01f, 9.343698025e-01f, 9.348921776e-01f, 
+        9.354143739e-01f, 9.359362125e-01f, 9.364577532e-01f, 9.369789958e-01f, 9.375000000e-01f, 9.380207062e-01f, 9.385411143e-01f, 9.390612245e-01f, 
+        9.395810366e-01f, 9.401005507e-01f, 9.406198263e-01f, 9.411387444e-01f, 9.416574240e-01f, 9.421758652e-01f, 9.426939487e-01f, 9.432117939e-01f, 
+        9.437292814e-01f, 9.442465305e-01f, 9.447635412e-01f, 9.452801943e-01f, 9.457966089e-01f, 9.463127255e-01f, 9.468286037e-01f, 9.473441243e-01f, 
+        9.478594065e-01f, 9.483744502e-01f, 9.488891363e-01f, 9.494035840e-01f, 9.499177337e-01f, 9.504316449e-01f, 9.509452581e-01f, 9.514585733e-01f, 
+        9.519716501e-01f, 9.524844289e-01f, 9.529969096e-01f, 9.535091519e-01f, 9.540210962e-01f, 9.545327425e-01f, 9.550441504e-01f, 9.555553198e-01f, 
+        9.560661316e-01f, 9.565767646e-01f, 9.570870399e-01f, 9.575970769e-01f, 9.581068754e-01f, 9.586163759e-01f, 9.591255784e-01f, 9.596345425e-01f, 
+        9.601432085e-01f, 9.606516361e-01f, 9.611597657e-01f, 9.616676569e-01f, 9.621752501e-01f, 9.626826048e-01f, 9.631896615e-01f, 9.636964798e-01f, 
+        9.642030597e-01f, 9.647093415e-01f, 9.652153254e-01f, 9.657210708e-01f, 9.662265778e-01f, 9.667317867e-01f, 9.672366977e-01f, 9.677414298e-01f, 
+        9.682458639e-01f, 9.687500000e-01f, 9.692538977e-01f, 9.697575569e-01f, 9.702609181e-01f, 9.707640409e-01f, 9.712668657e-01f, 9.717695117e-01f, 
+        9.722718000e-01f, 9.727739096e-01f, 9.732757211e-01f, 9.737772942e-01f, 9.742785692e-01f, 9.747796059e-01f, 9.752804041e-01f, 9.757809639e-01f, 
+        9.762812257e-01f, 9.767812490e-01f, 9.772809744e-01f, 9.777804613e-01f, 9.782797694e-01f, 9.787787199e-01f, 9.792774916e-01f, 9.797759652e-01f, 
+        9.802742004e-01f, 9.807721972e-01f, 9.812698960e-01f, 9.817673564e-01f, 9.822645783e-01f, 9.827615619e-01f, 9.832583070e-01f, 9.837547541e-01f, 
+        9.842509627e-01f, 9.847469330e-01f, 9.852426648e-01f, 9.857381582e-01f, 9.862333536e-01f, 9.867283106e-01f, 9.872230887e-01f, 9.877175689e-01f, 
+        9.882117510e-01f, 9.887057543e-01f, 9.891994596e-01f, 9.896929860e-01f, 9.901862144e-01f, 9.906792045e-01f, 9.911719561e-01f, 9.916644692e-01f, 
+        9.921567440e-01f, 9.926487803e-01f, 9.931405187e-01f, 9.936320782e-01f, 9.941233397e-01f, 9.946144223e-01f, 9.951052070e-01f, 9.955957532e-01f, 
+        9.960860610e-01f, 9.965761900e-01f, 9.970660210e-01f, 9.975556135e-01f, 9.980449677e-01f, 9.985340834e-01f, 9.990229607e-01f, 9.995115995e-01f, 
+        1.000000000e+00f, 
+    },
+    // sinpulse
+    {
+        0.000000000e+00f, 3.067956772e-03f, 6.135884672e-03f, 9.203754365e-03f, 1.227153838e-02f, 1.533920690e-02f, 1.840673015e-02f, 2.147408202e-02f, 
+        2.454122901e-02f, 2.760814503e-02f, 3.067480400e-02f, 3.374117613e-02f, 3.680722415e-02f, 3.987292945e-02f, 4.293825850e-02f, 4.600318149e-02f, 
+        4.906767607e-02f, 5.213170871e-02f, 5.519524589e-02f, 5.825826526e-02f, 6.132074073e-02f, 6.438263506e-02f, 6.744392216e-02f, 7.050457597e-02f, 
+        7.356456667e-02f, 7.662386447e-02f, 7.968243957e-02f, 8.274026960e-02f, 8.579731733e-02f, 8.885355294e-02f, 9.190895408e-02f, 9.496349841e-02f, 
+        9.801714122e-02f, 1.010698676e-01f, 1.041216403e-01f, 1.071724296e-01f, 1.102222055e-01f, 1.132709533e-01f, 1.163186356e-01f, 1.193652153e-01f, 
+        1.224106774e-01f, 1.254549772e-01f, 1.284981221e-01f, 1.315400302e-01f, 1.345807165e-01f, 1.376201212e-01f, 1.406582445e-01f, 1.436950415e-01f, 
+        1.467304677e-01f, 1.497645378e-01f, 1.527971923e-01f, 1.558284163e-01f, 1.588581502e-01f, 1.618863940e-01f, 1.649131328e-01f, 1.679382920e-01f, 
+        1.709619015e-01f, 1.739838719e-01f, 1.770042181e-01f, 1.800229102e-01f, 1.830398887e-01f, 1.860551685e-01f, 1.890686750e-01f, 1.920804083e-01f, 
+        1.950903237e-01f, 1.980984062e-01f, 2.011046410e-01f, 2.041089684e-01f, 2.071113884e-01f, 2.101118416e-01f, 2.131103277e-01f, 2.161068022e-01f, 
+        2.191012353e-01f, 2.220936269e-01f, 2.250839174e-01f, 2.280720919e-01f, 2.310581207e-01f, 2.340419590e-01f, 2.370236218e-01f, 2.400030196e-01f, 
+        2.429801971e-01f, 2.459550500e-01f, 2.489276081e-01f, 2.518978119e-01f, 2.548656762e-01f, 2.578310966e-01f, 2.607941329e-01f, 2.637546957e-01f, 
+        2.667127848e-01f, 2.696683407e-01f, 2.726213634e-01f, 2.755718231e-01f, 2.785196900e-01f, 2.814649343e-01f, 2.844075561e-01f, 2.873474956e-01f, 
+        2.902846932e-01f, 2.932191789e-01f, 2.961508930e-01f, 2.990798354e-01f, 3.020059466e-01f, 3.049292564e-01f, 3.078496754e-01f, 3.107671440e-01f, 
+        3.136817515e-01f, 3.165934086e-01f, 3.195020258e-01f, 3.224076927e-01f, 3.253103197e-01f, 3.282098472e-01f, 3.311063051e-01f, 3.339996636e-01f, 
+        3.368898630e-01f, 3.397768736e-01f, 3.426607251e-01f, 3.455413282e-01f, 3.484186828e-01f, 3.512927592e-01f, 3.541635275e-01f, 3.570309877e-01f, 
+        3.598950505e-01f, 3.627557456e-01f, 3.656130135e-01f, 3.684668243e-01f, 3.713172078e-01f, 3.741640747e-01f, 3.770074248e-01f, 3.798471987e-01f, 
+        3.826834559e-01f, 3.855160773e-01f, 3.883450329e-01f, 3.911703825e-01f, 3.939920664e-01f, 3.968100250e-01f, 3.996241987e-01f, 4.024346769e-01f, 
+        4.052413404e-01f, 4.080441594e-01f, 4.108431935e-01f, 4.136383235e-01f, 4.164295793e-01f, 4.192169011e-01f, 4.220002890e-01f, 4.247797132e-01f, 
+        4.275550842e-01f, 4.303264916e-01f, 4.330938458e-01f, 4.358571172e-01f, 4.386162460e-01f, 4.413712919e-01f, 4.441221654e-01f, 4.468688369e-01f, 
+        4.496113360e-01f, 4.523496032e-01f, 4.550835788e-01f, 4.578133225e-01f, 4.605387151e-01f, 4.632598162e-01f, 4.659765065e-01f, 4.686888456e-01f, 
+        4.713967443e-01f, 4.741002023e-01f, 4.767992496e-01f, 4.794937372e-01f, 4.821837544e-01f, 4.848692417e-01f, 4.875501692e-01f, 4.902265072e-01f, 
+        4.928982258e-01f, 4.955652952e-01f, 4.982276559e-01f, 5.008853674e-01f, 5.035383701e-01f, 5.061866641e-01f, 5.088301897e-01f, 5.114688873e-01f, 
+        5.141027570e-01f, 5.167317986e-01f, 5.193560123e-01f, 5.219752789e-01f, 5.245897174e-01f, 5.271991491e-01f, 5.298036337e-01f, 5.324031711e-01f, 
+        5.349975824e-01f, 5.375870466e-01f, 5.401715040e-01f, 5.427507758e-01f, 5.453249812e-01f, 5.478940606e-01f, 5.504580140e-01f, 5.530167222e-01f, 
+        5.555702448e-01f, 5.581185222e-01f, 5.606616139e-01f, 5.631993413e-01f, 5.657318234e-01f, 5.682590008e-01f, 5.707807541e-01f, 5.732971430e-01f, 
+        5.758082271e-01f, 5.783138275e-01f, 5.808140039e-01f, 5.833086967e-01f, 5.857979059e-01f, 5.882815719e-01f, 5.907596946e-01f, 5.932323337e-01f, 
+        5.956993103e-01f, 5.981607437e-01f, 6.006165147e-01f, 6.030666232e-01f, 6.055110097e-01f, 6.079497933e-01f, 6.103827953e-01f, 6.128100753e-01f, 
+        6.152316332e-01f, 6.176473498e-01f, 6.200572252e-01f, 6.224612594e-01f, 6.248595119e-01f, 6.272518039e-01f, 6.296382546e-01f, 6.320187449e-01f, 
+        6.343933344e-01f, 6.367618442e-01f, 6.391244531e-01f, 6.414810419e-01f, 6.438315511e-01f, 6.461760402e-01f, 6.485144496e-01f, 6.508467197e-01f, 
+        6.531728506e-01f, 6.554928422e-01f, 6.578066945e-01f, 6.601143479e-01f, 6.624158025e-01f, 6.647109985e-01f, 6.669999361e-01f, 6.692826152e-01f, 
+        6.715589762e-01f, 6.738290191e-01f, 6.760927439e-01f, 6.783500910e-01f, 6.806010008e-01f, 6.828455925e-01f, 6.850836873e-01f, 6.873153448e-01f, 
+        6.895405650e-01f, 6.917592883e-01f, 6.939714551e-01f, 6.961771846e-01f, 6.983762980e-01f, 7.005687952e-01f, 7.027547359e-01f, 7.049340606e-01f, 
+        7.071067691e-01f, 7.092728615e-01f, 7.114322186e-01f, 7.135848999e-01f, 7.157308459e-01f, 7.178700566e-01f, 7.200025320e-01f, 7.221282125e-01f, 
+        7.242470980e-01f, 7.263591886e-01f, 7.284644246e-01f, 7.305627465e-01f, 7.326542735e-01f, 7.347388864e-01f, 7.368165851e-01f, 7.388873696e-01f, 
+        7.409511805e-01f, 7.430079579e-01f, 7.450577617e-01f, 7.471005917e-01f, 7.491363883e-01f, 7.511651516e-01f, 7.531868219e-01f, 7.552013993e-01f, 
+        7.572088838e-01f, 7.592092156e-01f, 7.612023950e-01f, 7.631884217e-01f, 7.651672959e-01f, 7.671389580e-01f, 7.691033483e-01f, 7.710605860e-01f, 
+        7.730104327e-01f, 7.749531269e-01f, 7.768884897e-01f, 7.788165212e-01f, 7.807372808e-01f, 7.826506495e-01f, 7.845566273e-01f, 7.864552140e-01f, 
+        7.883464098e-01f, 7.902302146e-01f, 7.921065688e-01f, 7.939754725e-01f, 7.958369255e-01f, 7.976908684e-01f, 7.995373011e-01f, 8.013761640e-01f, 
+        8.032075167e-01f, 8.050313592e-01f, 8.068475723e-01f, 8.086562157e-01f, 8.104571700e-01f, 8.122506142e-01f, 8.140363097e-01f, 8.158144355e-01f, 
+        8.175848126e-01f, 8.193475604e-01f, 8.211025596e-01f, 8.228498101e-01f, 8.245893121e-01f, 8.263210654e-01f, 8.280450702e-01f, 8.297612667e-01f, 
+        8.314696550e-01f, 8.331701756e-01f, 8.348628879e-01f, 8.365477324e-01f, 8.382247090e-01f, 8.398938179e-01f, 8.415549397e-01f, 8.432082534e-01f, 
+        8.448535800e-01f, 8.464909196e-01f, 8.481203318e-01f, 8.497417569e-01f, 8.513551950e-01f, 8.529606462e-01f, 8.545579910e-01f, 8.561473489e-01f, 
+        8.577286601e-01f, 8.593018651e-01f, 8.608669639e-01f, 8.624240160e-01f, 8.639728427e-01f, 8.655136228e-01f, 8.670462370e-01f, 8.685706854e-01f, 
+        8.700869679e-01f, 8.715950847e-01f, 8.730949759e-01f, 8.745866418e-01f, 8.760701418e-01f, 8.775452971e-01f, 8.790122867e-01f, 8.804709315e-01f, 
+        8.819212914e-01f, 8.833633065e-01f, 8.847970963e-01f, 8.862225413e-01f, 8.876396418e-01f, 8.890483379e-01f, 8.904487491e-01f, 8.918406963e-01f, 
+        8.932242990e-01f, 8.945994973e-01f, 8.959662914e-01f, 8.973246217e-01f, 8.986744881e-01f, 9.000159502e-01f, 9.013488889e-01f, 9.026733041e-01f, 
+        9.039893150e-01f, 9.052967429e-01f, 9.065957069e-01f, 9.078861475e-01f, 9.091680050e-01f, 9.104412794e-01f, 9.117060304e-01f, 9.129621983e-01f, 
+        9.142097831e-01f, 9.154487252e-01f, 9.166790843e-01f, 9.179008007e-01f, 9.191138744e-01f, 9.203182459e-01f, 9.215140343e-01f, 9.227011204e-01f, 
+        9.238795042e-01f, 9.250492454e-01f, 9.262102246e-01f, 9.273625612e-01f, 9.285060763e-01f, 9.296408892e-01f, 9.307669997e-01f, 9.318842888e-01f, 
+        9.329928160e-01f, 9.340925813e-01f, 9.351835251e-01f, 9.362656474e-01f, 9.373390079e-01f, 9.384035468e-01f, 9.394592047e-01f, 9.405061007e-01f, 
+        9.415440559e-01f, 9.425731897e-01f, 9.435934424e-01f, 9.446048737e-01f, 9.456073642e-01f, 9.466009140e-01f, 9.475856423e-01f, 9.485613704e-01f, 
+        9.495282173e-01f, 9.504860640e-01f, 9.514350295e-01f, 9.523749948e-01f, 9.533060193e-01f, 9.542281032e-01f, 9.551411867e-01f, 9.560452700e-01f, 
+        9.569403529e-01f, 9.578264356e-01f, 9.587035179e-01f, 9.595715404e-01f, 9.604305625e-01f, 9.612805247e-01f, 9.621214271e-01f, 9.629532695e-01f, 
+        9.637760520e-01f, 9.645897746e-01f, 9.653944373e-01f, 9.661899805e-01f, 9.669764638e-01f, 9.677538276e-01f, 9.685221314e-01f, 9.692812562e-01f, 
+        9.700312614e-01f, 9.707721472e-01f, 9.715039134e-01f, 9.722265005e-01f, 9.729399681e-01f, 9.736442566e-01f, 9.743393660e-01f, 9.750253558e-01f, 
+        9.757021070e-01f, 9.763697386e-01f, 9.770281315e-01f, 9.776773453e-01f, 9.783173800e-01f, 9.789481759e-01f, 9.795697927e-01f, 9.801821709e-01f, 
+        9.807853103e-01f, 9.813792109e-01f, 9.819638729e-01f, 9.825392962e-01f, 9.831054807e-01f, 9.836624265e-01f, 9.842100739e-01f, 9.847484827e-01f, 
+        9.852776527e-01f, 9.857975245e-01f, 9.863080978e-01f, 9.868094325e-01f, 9.873014092e-01f, 9.877841473e-01f, 9.882575870e-01f, 9.887217283e-01f, 
+        9.891765118e-01f, 9.896219969e-01f, 9.900581837e-01f, 9.904850721e-01f, 9.909026623e-01f, 9.913108349e-01f, 9.917097688e-01f, 9.920993447e-01f, 
+        9.924795628e-01f, 9.928504229e-01f, 9.932119846e-01f, 9.935641289e-01f, 9.939069748e-01f, 9.942404628e-01f, 9.945645928e-01f, 9.948793054e-01f, 
+        9.951847196e-01f, 9.954807758e-01f, 9.957674146e-01f, 9.960446954e-01f, 9.963126183e-01f, 9.965711236e-01f, 9.968203306e-01f, 9.970600605e-01f, 
+        9.972904325e-01f, 9.975114465e-01f, 9.977231026e-01f, 9.979252815e-01f, 9.981181026e-01f, 9.983015656e-01f, 9.984755516e-01f, 9.986402392e-01f, 
+        9.987954497e-01f, 9.989413023e-01f, 9.990777373e-01f, 9.992047548e-01f, 9.993224144e-01f, 9.994305968e-01f, 9.995294213e-01f, 9.996188283e-01f, 
+        9.996988177e-01f, 9.997693896e-01f, 9.998306036e-01f, 9.998823404e-01f, 9.999247193e-01f, 9.999576211e-01f, 9.999811649e-01f, 9.999952912e-01f, 
+        1.000000000e+00f, 9.999952912e-01f, 9.999811649e-01f, 9.999576211e-01f, 9.999247193e-01f, 9.998823404e-01f, 9.998306036e-01f, 9.997693896e-01f, 
+        9.996988177e-01f, 9.996188283e-01f, 9.995294213e-01f, 9.994305968e-01f, 9.993223548e-01f, 9.992047548e-01f, 9.990777373e-01f, 9.989413023e-01f, 
+        9.987954497e-01f, 9.986402392e-01f, 9.984755516e-01f, 9.983015656e-01f, 9.981181026e-01f, 9.979252815e-01f, 9.977230430e-01f, 9.975114465e-01f, 
+        9.972904325e-01f, 9.970600605e-01f, 9.968202710e-01f, 9.965711236e-01f, 9.963126183e-01f, 9.960446954e-01f, 9.957674146e-01f, 9.954807758e-01f, 
+        9.951847196e-01f, 9.948793054e-01f, 9.945645332e-01f, 9.942404628e-01f, 9.939069748e-01f, 9.935641289e-01f, 9.932119250e-01f, 9.928504229e-01f, 
+        9.924795032e-01f, 9.920992851e-01f, 9.917097688e-01f, 9.913108349e-01f, 9.909026027e-01f, 9.904850721e-01f, 9.900581837e-01f, 9.896219969e-01f, 
+        9.891765118e-01f, 9.887216687e-01f, 9.882575870e-01f, 9.877841473e-01f, 9.873014092e-01f, 9.868093729e-01f, 9.863080978e-01f, 9.857975245e-01f, 
+        9.852776527e-01f, 9.847484827e-01f, 9.842100739e-01f, 9.836624265e-01f, 9.831054807e-01f, 9.825392962e-01f, 9.819638729e-01f, 9.813792109e-01f, 
+        9.807852507e-01f, 9.801821113e-01f, 9.795697331e-01f, 9.789481759e-01f, 9.783173800e-01f, 9.776773453e-01f, 9.770281315e-01f, 9.763697386e-01f, 
+        9.757021070e-01f, 9.750253558e-01f, 9.743393660e-01f, 9.736442566e-01f, 9.729399085e-01f, 9.722265005e-01f, 9.715039134e-01f, 9.707721472e-01f, 
+        9.700312614e-01f, 9.692812562e-01f, 9.685220718e-01f, 9.677538276e-01f, 9.669764638e-01f, 9.661899805e-01f, 9.653944373e-01f, 9.645897746e-01f, 
+        9.637760520e-01f, 9.629532099e-01f, 9.621214271e-01f, 9.612804651e-01f, 9.604305029e-01f, 9.595714808e-01f, 9.587034583e-01f, 9.578263760e-01f, 
+        9.569402933e-01f, 9.560452104e-01f, 9.551411271e-01f, 9.542281032e-01f, 9.533060193e-01f, 9.523749948e-01f, 9.514349699e-01f, 9.504860640e-01f, 
+        9.495281577e-01f, 9.485613704e-01f, 9.475855827e-01f, 9.466009140e-01f, 9.456073046e-01f, 9.446048141e-01f, 9.435934424e-01f, 9.425731897e-01f, 
+        9.415440559e-01f, 9.405060410e-01f, 9.394592047e-01f, 9.384034872e-01f, 9.373389482e-01f, 9.362656474e-01f, 9.351835251e-01f, 9.340925217e-01f, 
+        9.329928160e-01f, 9.318842292e-01f, 9.307669401e-01f, 9.296408892e-01f, 9.285060763e-01f, 9.273625016e-01f, 9.262102246e-01f, 9.250491858e-01f, 
+        9.238795042e-01f, 9.227011204e-01f, 9.215139747e-01f, 9.203182459e-01f, 9.191138744e-01f, 9.179008007e-01f, 9.166790247e-01f, 9.154487252e-01f, 
+        9.142097235e-01f, 9.129621983e-01f, 9.117060304e-01f, 9.104412794e-01f, 9.091680050e-01f, 9.078861475e-01f, 9.065957069e-01f, 9.052967429e-01f, 
+        9.039893150e-01f, 9.026733041e-01f, 9.013488293e-01f, 9.000158906e-01f, 8.986744285e-01f, 8.973245621e-01f, 8.959662318e-01f, 8.945994377e-01f, 
+        8.932242990e-01f, 8.918406963e-01f, 8.904486895e-01f, 8.890483379e-01f, 8.876395822e-01f, 8.862224817e-01f, 8.847970366e-01f, 8.833633065e-01f, 
+        8.819212317e-01f, 8.804708123e-01f, 8.790121675e-01f, 8.775452375e-01f, 8.760700226e-01f, 8.745865822e-01f, 8.730949163e-01f, 8.715950847e-01f, 
+        8.700870275e-01f, 8.685707450e-01f, 8.670462370e-01f, 8.655136228e-01f, 8.639728427e-01f, 8.624239564e-01f, 8.608669639e-01f, 8.593018055e-01f, 
+        8.577286005e-01f, 8.561472893e-01f, 8.545579910e-01f, 8.529605865e-01f, 8.513551354e-01f, 8.497417569e-01f, 8.481203318e-01f, 8.464909196e-01f, 
+        8.448535204e-01f, 8.432081938e-01f, 8.415549397e-01f, 8.398937583e-01f, 8.382246494e-01f, 8.365476727e-01f, 8.348627687e-01f, 8.331700563e-01f, 
+        8.314695358e-01f, 8.297611475e-01f, 8.280450702e-01f, 8.263210654e-01f, 8.245893121e-01f, 8.228498101e-01f, 8.211025000e-01f, 8.193475008e-01f, 
+        8.175848126e-01f, 8.158144355e-01f, 8.140363097e-01f, 8.122505546e-01f, 8.104571700e-01f, 8.086561561e-01f, 8.068475127e-01f, 8.050312996e-01f, 
+        8.032075167e-01f, 8.013761044e-01f, 7.995372415e-01f, 7.976908088e-01f, 7.958368659e-01f, 7.939754128e-01f, 7.921065092e-01f, 7.902301550e-01f, 
+        7.883463502e-01f, 7.864551544e-01f, 7.845565081e-01f, 7.826504707e-01f, 7.807371020e-01f, 7.788164020e-01f, 7.768884897e-01f, 7.749531269e-01f, 
+        7.730104923e-01f, 7.710605264e-01f, 7.691033483e-01f, 7.671388984e-01f, 7.651672363e-01f, 7.631884217e-01f, 7.612023950e-01f, 7.592091560e-01f, 
+        7.572088242e-01f, 7.552013397e-01f, 7.531867623e-01f, 7.511650920e-01f, 7.491363287e-01f, 7.471005321e-01f, 7.450577021e-01f, 7.430078983e-01f, 
+        7.409510612e-01f, 7.388872504e-01f, 7.368164659e-01f, 7.347387671e-01f, 7.326541543e-01f, 7.305626869e-01f, 7.284643054e-01f, 7.263590693e-01f, 
+        7.242469788e-01f, 7.221280932e-01f, 7.200025320e-01f, 7.178700566e-01f, 7.157308459e-01f, 7.135848999e-01f, 7.114322186e-01f, 7.092728019e-01f, 
+        7.071067691e-01f, 7.049340606e-01f, 7.027547359e-01f, 7.005687952e-01f, 6.983762383e-01f, 6.961771250e-01f, 6.939713955e-01f, 6.917592287e-01f, 
+        6.895405054e-01f, 6.873152852e-01f, 6.850836277e-01f, 6.828454733e-01f, 6.806009412e-01f, 6.783499718e-01f, 6.760926247e-01f, 6.738288999e-01f, 
+        6.715588570e-01f, 6.692824960e-01f, 6.669998169e-01f, 6.647108793e-01f, 6.624156237e-01f, 6.601144075e-01f, 6.578067541e-01f, 6.554929018e-01f, 
+        6.531728506e-01f, 6.508467197e-01f, 6.485143900e-01f, 6.461760402e-01f, 6.438315511e-01f, 6.414809823e-01f, 6.391244531e-01f, 6.367618442e-01f, 
+        6.343932748e-01f, 6.320186853e-01f, 6.296381950e-01f, 6.272517443e-01f, 6.248594522e-01f, 6.224611998e-01f, 6.200571060e-01f, 6.176472306e-01f, 
+        6.152315140e-01f, 6.128099561e-01f, 6.103826761e-01f, 6.079496741e-01f, 6.055109501e-01f, 6.030664444e-01f, 6.006163359e-01f, 5.981605649e-01f, 
+        5.956991315e-01f, 5.932323337e-01f, 5.907597542e-01f, 5.882815719e-01f, 5.857978463e-01f, 5.833086371e-01f, 5.808139443e-01f, 5.783137679e-01f, 
+        5.758081675e-01f, 5.732971430e-01f, 5.707806945e-01f, 5.682589412e-01f, 5.657317638e-01f, 5.631992817e-01f, 5.606614947e-01f, 5.581184626e-01f, 
+        5.555701852e-01f, 5.530166030e-01f, 5.504578948e-01f, 5.478939414e-01f, 5.453248620e-01f, 5.427506566e-01f, 5.401713252e-01f, 5.375869274e-01f, 
+        5.349974632e-01f, 5.324029922e-01f, 5.298034549e-01f, 5.271989703e-01f, 5.245895386e-01f, 5.219753385e-01f, 5.193560123e-01f, 5.167317986e-01f, 
+        5.141027570e-01f, 5.114688277e-01f, 5.088301301e-01f, 5.061866045e-01f, 5.035383701e-01f, 5.008853674e-01f, 4.982276261e-01f, 4.955652058e-01f, 
+        4.928981364e-01f, 4.902264178e-01f, 4.875500798e-01f, 4.848691821e-01f, 4.821836948e-01f, 4.794936776e-01f, 4.767991304e-01f, 4.741001129e-01f, 
+        4.713966250e-01f, 4.686886966e-01f, 4.659763575e-01f, 4.632596374e-01f, 4.605385661e-01f, 4.578131437e-01f, 4.550834298e-01f, 4.523494244e-01f, 
+        4.496113658e-01f, 4.468688667e-01f, 4.441221654e-01f, 4.413712919e-01f, 4.386162460e-01f, 4.358570874e-01f, 4.330938160e-01f, 4.303264618e-01f, 
+        4.275550544e-01f, 4.247796535e-01f, 4.220002294e-01f, 4.192168415e-01f, 4.164294899e-01f, 4.136382341e-01f, 4.108431041e-01f, 4.080440700e-01f, 
+        4.052412212e-01f, 4.024345577e-01f, 3.996241093e-01f, 3.968098760e-01f, 3.939919174e-01f, 3.911702633e-01f, 3.883449137e-01f, 3.855158985e-01f, 
+        3.826832771e-01f, 3.798470497e-01f, 3.770072460e-01f, 3.741638958e-01f, 3.713172376e-01f, 3.684668541e-01f, 3.656130135e-01f, 3.627557456e-01f, 
+        3.598950505e-01f, 3.570309579e-01f, 3.541635275e-01f, 3.512927294e-01f, 3.484186530e-01f, 3.455412984e-01f, 3.426606655e-01f, 3.397768438e-01f, 
+        3.368898034e-01f, 3.339995742e-01f, 3.311062157e-01f, 3.282097578e-01f, 3.253102005e-01f, 3.224075735e-01f, 3.195019066e-01f, 3.165932596e-01f, 
+        3.136816025e-01f, 3.107670248e-01f, 3.078494966e-01f, 3.049290776e-01f, 3.020057976e-01f, 2.990796566e-01f, 2.961507142e-01f, 2.932189703e-01f, 
+        2.902847230e-01f, 2.873474956e-01f, 2.844075561e-01f, 2.814649343e-01f, 2.785196900e-01f, 2.755718231e-01f, 2.726213336e-01f, 2.696683109e-01f, 
+        2.667127252e-01f, 2.637546360e-01f, 2.607940733e-01f, 2.578310370e-01f, 2.548655868e-01f, 2.518977523e-01f, 2.489275187e-01f, 2.459549606e-01f, 
+        2.429800779e-01f, 2.400029153e-01f, 2.370234877e-01f, 2.340418249e-01f, 2.310579717e-01f, 2.280719429e-01f, 2.250837535e-01f, 2.220934629e-01f, 
+        2.191010714e-01f, 2.161066234e-01f, 2.131101340e-01f, 2.101118714e-01f, 2.071114033e-01f, 2.041089833e-01f, 2.011046410e-01f, 1.980984062e-01f, 
+        1.950903088e-01f, 1.920803785e-01f, 1.890686452e-01f, 1.860551238e-01f, 1.830398440e-01f, 1.800228506e-01f, 1.770041585e-01f, 1.739838123e-01f, 
+        1.709618121e-01f, 1.679382175e-01f, 1.649130285e-01f, 1.618862897e-01f, 1.588580310e-01f, 1.558282822e-01f, 1.527970582e-01f, 1.497644037e-01f, 
+        1.467303336e-01f, 1.436948776e-01f, 1.406580806e-01f, 1.376199573e-01f, 1.345805228e-01f, 1.315398365e-01f, 1.284979135e-01f, 1.254550070e-01f, 
+        1.224106997e-01f, 1.193652302e-01f, 1.163186356e-01f, 1.132709458e-01f, 1.102221981e-01f, 1.071724072e-01f, 1.041216031e-01f, 1.010698229e-01f, 
+        9.801709652e-02f, 9.496343881e-02f, 9.190889448e-02f, 8.885347843e-02f, 8.579722792e-02f, 8.274017274e-02f, 7.968233526e-02f, 7.662375271e-02f, 
+        7.356444746e-02f, 7.050444931e-02f, 6.744378805e-02f, 6.438248605e-02f, 6.132058427e-02f, 5.825810507e-02f, 5.519507453e-02f, 5.213152617e-02f, 
+        4.906748608e-02f, 4.600298777e-02f, 4.293805361e-02f, 3.987295181e-02f, 3.680723906e-02f, 3.374117985e-02f, 3.067480214e-02f, 2.760813758e-02f, 
+        2.454121038e-02f, 2.147405408e-02f, 1.840669475e-02f, 1.533916220e-02f, 1.227148529e-02f, 9.203693829e-03f, 6.135814823e-03f, 3.067878075e-03f, 
+        0.000000000e+00f, 
+    },
+};
+
+#endif // INTERP_LUTS_H_
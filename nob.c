@@ -9,11 +9,14 @@ void cflags(Nob_Cmd *cmd)
     nob_cmd_append(cmd, "-Wall", "-Wextra", "-ggdb");
     nob_cmd_append(cmd, "-I./raylib/raylib-5.0_linux_amd64/include");
     nob_cmd_append(cmd, "-I./src/");
+    nob_cmd_append(cmd, "-I"BUILD_DIR); // For the generated headers
+    nob_cmd_append(cmd, "-DARENA_BACKEND=ARENA_BACKEND_LINUX_MMAP"); // Arenas reserve their memory upfront, see arena.h
 }
 
 void cc(Nob_Cmd *cmd)
 {
     nob_cmd_append(cmd, "cc");
+    nob_cmd_append(cmd, "-Werror=incompatible-pointer-types"); // Catches task functions registered with the wrong signature
     cflags(cmd);
 }
 
@@ -88,6 +91,34 @@ bool build_exe(bool force, Nob_Cmd *cmd, const char **input_paths, size_t input_
     return true;
 }
 
+bool generate_interp_luts(bool force, Nob_Cmd *cmd)
+{
+    const char *generator_path = BUILD_DIR"/interp_luts_gen";
+    const char *output_path = BUILD_DIR"/interp_luts.h";
+    const char *input_paths[] = {
+        SRC_DIR"/interp_luts_gen.c",
+        SRC_DIR"/interpolators.h",
+    };
+    int rebuild_is_needed = nob_needs_rebuild(output_path, input_paths, NOB_ARRAY_LEN(input_paths));
+    if (rebuild_is_needed < 0) return false;
+
+    if (force || rebuild_is_needed) {
+        cmd->count = 0;
+        cc(cmd);
+        nob_cmd_append(cmd, "-o", generator_path);
+        nob_cmd_append(cmd, SRC_DIR"/interp_luts_gen.c");
+        libs(cmd);
+        if (!nob_cmd_run_sync(*cmd)) return false;
+
+        cmd->count = 0;
+        nob_cmd_append(cmd, generator_path, output_path);
+        return nob_cmd_run_sync(*cmd);
+    }
+
+    nob_log(NOB_INFO, "%s is up-to-date", output_path);
+    return true;
+}
+
 int main(int argc, char **argv)
 {
     NOB_GO_REBUILD_URSELF(argc, argv);
@@ -96,10 +127,13 @@ int main(int argc, char **argv)
     (void) program_name;
 
     bool force = false;
+    bool test = false;
     while (argc > 0) {
         const char *flag = nob_shift_args(&argc, &argv);
         if (strcmp(flag, "-f") == 0) {
             force = true;
+        } else if (strcmp(flag, "test") == 0) {
+            test = true;
         } else {
             nob_log(NOB_ERROR, "Unknown flag %s", flag);
             return 1;
@@ -109,6 +143,7 @@ int main(int argc, char **argv)
     if (!nob_mkdir_if_not_exists(BUILD_DIR)) return 1;
 
     Nob_Cmd cmd = {0};
+    if (!generate_interp_luts(force, &cmd)) return 1;
     if (!build_plug_c(force, &cmd, SRC_DIR"/tm.c", BUILD_DIR"/libtm.so")) return 1;
     if (!build_plug_c(force, &cmd, SRC_DIR"/template.c", BUILD_DIR"/libtemplate.so")) return 1;
     if (!build_plug_c(force, &cmd, SRC_DIR"/squares.c", BUILD_DIR"/libsquare.so")) return 1;
@@ -119,11 +154,53 @@ int main(int argc, char **argv)
         const char *output_path = BUILD_DIR"/panim";
         const char *input_paths[] = {
             SRC_DIR"/panim.c",
-            SRC_DIR"/ffmpeg_linux.c"
+            SRC_DIR"/ffmpeg_linux.c",
+            SRC_DIR"/readback.c",
+            SRC_DIR"/render_stats.c",
+            SRC_DIR"/trace.c",
+            SRC_DIR"/mixer.c",
+            SRC_DIR"/yuv.c",
         };
         size_t input_paths_len = NOB_ARRAY_LEN(input_paths);
         if (!build_exe(force, &cmd, input_paths, input_paths_len, output_path)) return 1;
     }
 
+    {
+        const char *output_path = BUILD_DIR"/interp_bench";
+        const char *input_paths[] = {
+            SRC_DIR"/interp_bench.c",
+        };
+        size_t input_paths_len = NOB_ARRAY_LEN(input_paths);
+        if (!build_exe(force, &cmd, input_paths, input_paths_len, output_path)) return 1;
+    }
+
+    {
+        const char *output_path = BUILD_DIR"/tasks_test";
+        const char *input_paths[] = {
+            SRC_DIR"/tasks_test.c",
+            SRC_DIR"/tasks.c",
+        };
+        size_t input_paths_len = NOB_ARRAY_LEN(input_paths);
+        if (!build_exe(force, &cmd, input_paths, input_paths_len, output_path)) return 1;
+    }
+
+    {
+        const char *output_path = BUILD_DIR"/arena_test";
+        const char *input_paths[] = {
+            SRC_DIR"/arena_test.c",
+        };
+        size_t input_paths_len = NOB_ARRAY_LEN(input_paths);
+        if (!build_exe(force, &cmd, input_paths, input_paths_len, output_path)) return 1;
+    }
+
+    if (test) {
+        cmd.count = 0;
+        nob_cmd_append(&cmd, BUILD_DIR"/tasks_test");
+        if (!nob_cmd_run_sync(cmd)) return 1;
+        cmd.count = 0;
+        nob_cmd_append(&cmd, BUILD_DIR"/arena_test");
+        if (!nob_cmd_run_sync(cmd)) return 1;
+    }
+
     return 0;
 }
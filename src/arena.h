@@ -54,19 +54,36 @@ struct Region {
     uintptr_t data[];
 };
 
+// Counters for picking the region sizes and spotting wasteful growth patterns. All sizes are in
+// bytes. requested, allocated, realloc_waste and skipped start over on arena_reset(), the rest
+// lives until arena_free().
+typedef struct {
+    size_t regions;       // Amount of regions in the chain
+    size_t reserved;      // Capacity of all the regions
+    size_t requested;     // Sum of the sizes passed to arena_alloc()
+    size_t allocated;     // Currently in use, including the alignment padding
+    size_t peak;          // High-water mark of allocated
+    size_t realloc_waste; // Old copies left behind by arena_realloc() (and so arena_da_append())
+    size_t skipped;       // Unused tails of the regions that arena_alloc() had to move past
+} Arena_Stats;
+
 typedef struct {
     Region *begin, *end;
+    Arena_Stats stats;
 } Arena;
 
 #define REGION_DEFAULT_CAPACITY (8*1024)
 
 Region *new_region(size_t capacity);
 void free_region(Region *r);
+// Gives the memory past r->count back to the OS. Does nothing on the backends that can't do that
+void trim_region(Region *r);
+
+typedef struct {
+    Region *region;
+    size_t count;
+} Arena_Mark;
 
-// TODO: snapshot/rewind capability for the arena
-// - Snapshot should be combination of a->end and a->end->count.
-// - Rewinding should be restoring a->end and a->end->count from the snapshot and
-// setting count-s of all the Region-s after the remembered a->end to 0.
 void *arena_alloc(Arena *a, size_t size_bytes);
 void *arena_realloc(Arena *a, void *oldptr, size_t oldsz, size_t newsz);
 char *arena_strdup(Arena *a, const char *cstr);
@@ -77,6 +94,20 @@ char *arena_sprintf(Arena *a, const char *format, ...);
 
 void arena_reset(Arena *a);
 void arena_free(Arena *a);
+// Releases the memory of everything that is not allocated right now (e.g. after arena_reset())
+// without unmapping the regions, so the arena can be refilled without any new regions
+void arena_trim(Arena *a);
+
+// Remembers how much of the arena is allocated, arena_rewind() frees everything allocated after that
+Arena_Mark arena_snapshot(Arena *a);
+void arena_rewind(Arena *a, Arena_Mark m);
+
+// Copy of everything allocated in the arena. Unlike arena_rewind(), arena_load() also brings back the
+// data that was modified in place since arena_save(). Only works while the arena still has all the
+// regions it had when it was saved, that is until arena_free().
+size_t arena_save_size(const Arena *a);
+void arena_save(const Arena *a, void *buf);
+void arena_load(Arena *a, const void *buf);
 
 #define ARENA_DA_INIT_CAP 256
 
@@ -125,18 +156,40 @@ void free_region(Region *r)
 {
     free(r);
 }
+
+void trim_region(Region *r)
+{
+    (void) r;
+}
 #elif ARENA_BACKEND == ARENA_BACKEND_LINUX_MMAP
 #include <unistd.h>
 #include <sys/mman.h>
 
+// Every region reserves at least this much of the address space upfront. The mapping is not backed
+// by anything until the pages are touched, so the memory is committed on demand while a single
+// region is usually enough for the whole arena and arena_alloc() never walks a chain of regions.
+#ifndef ARENA_MMAP_RESERVE
+#define ARENA_MMAP_RESERVE (1ull<<30)
+#endif // ARENA_MMAP_RESERVE
+
 Region *new_region(size_t capacity)
 {
     size_t size_bytes = sizeof(Region) + sizeof(uintptr_t) * capacity;
-    Region *r = mmap(NULL, size_bytes, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    size_t reserve_bytes = size_bytes < ARENA_MMAP_RESERVE ? ARENA_MMAP_RESERVE : size_bytes;
+    Region *r = (Region*)mmap(NULL, reserve_bytes, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE, -1, 0);
+    if (r == MAP_FAILED) {
+        // With vm.overcommit_memory=2 the kernel does not let us reserve more than we can commit
+        reserve_bytes = size_bytes;
+        r = (Region*)mmap(NULL, reserve_bytes, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    }
     ARENA_ASSERT(r != MAP_FAILED);
+#ifdef ARENA_MMAP_HUGEPAGES
+    // Only a hint. Fails quietly if transparent huge pages are disabled
+    madvise(r, reserve_bytes, MADV_HUGEPAGE);
+#endif // ARENA_MMAP_HUGEPAGES
     r->next = NULL;
     r->count = 0;
-    r->capacity = capacity;
+    r->capacity = (reserve_bytes - sizeof(Region))/sizeof(uintptr_t);
     return r;
 }
 
@@ -147,6 +200,18 @@ void free_region(Region *r)
     ARENA_ASSERT(ret == 0);
 }
 
+void trim_region(Region *r)
+{
+    uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t begin = ((uintptr_t)&r->data[r->count] + page - 1) & ~(page - 1);
+    uintptr_t end = (uintptr_t)&r->data[r->capacity] & ~(page - 1);
+    if (begin < end) {
+        // The pages stay mapped and come back zeroed on the next touch
+        int ret = madvise((void*)begin, end - begin, MADV_DONTNEED);
+        ARENA_ASSERT(ret == 0);
+    }
+}
+
 #elif ARENA_BACKEND == ARENA_BACKEND_WIN32_VIRTUALALLOC
 
 #if !defined(_WIN32)
@@ -193,17 +258,35 @@ void free_region(Region *r)
         ARENA_ASSERT(0 && "VirtualFreeEx() failed.");
 }
 
+void trim_region(Region *r)
+{
+    (void) r;
+}
+
 #elif ARENA_BACKEND == ARENA_BACKEND_WASM_HEAPBASE
 #  error "TODO: WASM __heap_base backend is not implemented yet"
 #else
 #  error "Unknown Arena backend"
 #endif
 
-// TODO: add debug statistic collection mode for arena
-// Should collect things like:
-// - How many times new_region was called
-// - How many times existing region was skipped
-// - How many times allocation exceeded REGION_DEFAULT_CAPACITY
+static Region *arena__new_region(Arena *a, size_t size)
+{
+    size_t capacity = REGION_DEFAULT_CAPACITY;
+    if (capacity < size) capacity = size;
+    Region *r = new_region(capacity);
+    a->stats.regions += 1;
+    a->stats.reserved += sizeof(uintptr_t)*r->capacity;
+    return r;
+}
+
+static void arena__count_allocated(Arena *a)
+{
+    a->stats.allocated = 0;
+    if (a->end == NULL) return;
+    for (Region *r = a->begin; r != a->end->next; r = r->next) {
+        a->stats.allocated += sizeof(uintptr_t)*r->count;
+    }
+}
 
 void *arena_alloc(Arena *a, size_t size_bytes)
 {
@@ -211,32 +294,35 @@ void *arena_alloc(Arena *a, size_t size_bytes)
 
     if (a->end == NULL) {
         ARENA_ASSERT(a->begin == NULL);
-        size_t capacity = REGION_DEFAULT_CAPACITY;
-        if (capacity < size) capacity = size;
-        a->end = new_region(capacity);
+        a->end = arena__new_region(a, size);
         a->begin = a->end;
     }
 
     while (a->end->count + size > a->end->capacity && a->end->next != NULL) {
+        a->stats.skipped += sizeof(uintptr_t)*(a->end->capacity - a->end->count);
         a->end = a->end->next;
     }
 
     if (a->end->count + size > a->end->capacity) {
         ARENA_ASSERT(a->end->next == NULL);
-        size_t capacity = REGION_DEFAULT_CAPACITY;
-        if (capacity < size) capacity = size;
-        a->end->next = new_region(capacity);
+        a->stats.skipped += sizeof(uintptr_t)*(a->end->capacity - a->end->count);
+        a->end->next = arena__new_region(a, size);
         a->end = a->end->next;
     }
 
     void *result = &a->end->data[a->end->count];
     a->end->count += size;
+
+    a->stats.requested += size_bytes;
+    a->stats.allocated += sizeof(uintptr_t)*size;
+    if (a->stats.peak < a->stats.allocated) a->stats.peak = a->stats.allocated;
     return result;
 }
 
 void *arena_realloc(Arena *a, void *oldptr, size_t oldsz, size_t newsz)
 {
     if (newsz <= oldsz) return oldptr;
+    a->stats.realloc_waste += oldsz;
     void *newptr = arena_alloc(a, newsz);
     char *newptr_char = (char*)newptr;
     char *oldptr_char = (char*)oldptr;
@@ -285,6 +371,17 @@ void arena_reset(Arena *a)
     }
 
     a->end = a->begin;
+    a->stats.requested = 0;
+    a->stats.allocated = 0;
+    a->stats.realloc_waste = 0;
+    a->stats.skipped = 0;
+}
+
+void arena_trim(Arena *a)
+{
+    for (Region *r = a->begin; r != NULL; r = r->next) {
+        trim_region(r);
+    }
 }
 
 void arena_free(Arena *a)
@@ -297,6 +394,84 @@ void arena_free(Arena *a)
     }
     a->begin = NULL;
     a->end = NULL;
+    memset(&a->stats, 0, sizeof(a->stats));
+}
+
+Arena_Mark arena_snapshot(Arena *a)
+{
+    Arena_Mark m;
+    m.region = a->end;
+    m.count = a->end != NULL ? a->end->count : 0;
+    return m;
+}
+
+void arena_rewind(Arena *a, Arena_Mark m)
+{
+    if (m.region == NULL) {
+        arena_reset(a);
+        return;
+    }
+
+    m.region->count = m.count;
+    for (Region *r = m.region->next; r != NULL; r = r->next) {
+        r->count = 0;
+    }
+    a->end = m.region;
+    arena__count_allocated(a);
+}
+
+// Layout of the buffer: amount of regions, then the count and the used data of every region from a->begin to a->end
+size_t arena_save_size(const Arena *a)
+{
+    size_t size = sizeof(size_t);
+    if (a->end == NULL) return size;
+    for (Region *r = a->begin; r != a->end->next; r = r->next) {
+        size += sizeof(size_t) + sizeof(uintptr_t)*r->count;
+    }
+    return size;
+}
+
+void arena_save(const Arena *a, void *buf)
+{
+    char *cursor = (char*)buf + sizeof(size_t);
+    size_t regions = 0;
+    if (a->end != NULL) {
+        for (Region *r = a->begin; r != a->end->next; r = r->next) {
+            memcpy(cursor, &r->count, sizeof(r->count));
+            cursor += sizeof(r->count);
+            memcpy(cursor, r->data, sizeof(uintptr_t)*r->count);
+            cursor += sizeof(uintptr_t)*r->count;
+            regions += 1;
+        }
+    }
+    memcpy(buf, &regions, sizeof(regions));
+}
+
+void arena_load(Arena *a, const void *buf)
+{
+    size_t regions = 0;
+    memcpy(&regions, buf, sizeof(regions));
+    const char *cursor = (const char*)buf + sizeof(regions);
+
+    Region *r = a->begin;
+    Region *last = NULL;
+    for (size_t i = 0; i < regions; ++i) {
+        ARENA_ASSERT(r != NULL && "The arena lost some of its regions since it was saved");
+        size_t count = 0;
+        memcpy(&count, cursor, sizeof(count));
+        cursor += sizeof(count);
+        ARENA_ASSERT(count <= r->capacity);
+        memcpy(r->data, cursor, sizeof(uintptr_t)*count);
+        cursor += sizeof(uintptr_t)*count;
+        r->count = count;
+        last = r;
+        r = r->next;
+    }
+    for (; r != NULL; r = r->next) {
+        r->count = 0;
+    }
+    a->end = last != NULL ? last : a->begin;
+    arena__count_allocated(a);
 }
 
 #endif // ARENA_IMPLEMENTATION
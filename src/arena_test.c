@@ -0,0 +1,190 @@
+// Checks the ARENA_BACKEND_LINUX_MMAP backend of arena.h: the upfront reservation and its fallback, the
+// page rounding of arena_trim() and that arena_free() unmaps the whole reservation.
+// Build with ./nob and run ./build/arena_test (or just ./nob test)
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#undef ARENA_BACKEND
+#define ARENA_BACKEND ARENA_BACKEND_LINUX_MMAP
+// Smaller than the default, so the fallback test does not need a huge address space to fail in
+#define ARENA_MMAP_RESERVE (64ull<<20)
+#include "arena.h"
+
+static size_t failed = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "FAIL: %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failed += 1; \
+        } \
+    } while (0)
+
+static size_t page_size(void)
+{
+    return (size_t)sysconf(_SC_PAGESIZE);
+}
+
+static bool page_resident(const void *ptr)
+{
+    unsigned char vec = 0;
+    void *page = (void*)((uintptr_t)ptr & ~(uintptr_t)(page_size() - 1));
+    if (mincore(page, page_size(), &vec) < 0) return false;
+    return vec & 1;
+}
+
+static bool page_mapped(const void *ptr)
+{
+    unsigned char vec = 0;
+    void *page = (void*)((uintptr_t)ptr & ~(uintptr_t)(page_size() - 1));
+    return mincore(page, page_size(), &vec) == 0 || errno != ENOMEM;
+}
+
+static void test_reservation(void)
+{
+    Arena a = {0};
+    arena_alloc(&a, 1);
+    CHECK(a.begin != NULL);
+    CHECK(sizeof(Region) + sizeof(uintptr_t)*a.begin->capacity == ARENA_MMAP_RESERVE);
+
+    // Way more than REGION_DEFAULT_CAPACITY still fits into the first region
+    size_t size = 64*REGION_DEFAULT_CAPACITY*sizeof(uintptr_t);
+    char *big = (char*)arena_alloc(&a, size);
+    memset(big, 0x69, size);
+    CHECK(a.begin == a.end);
+    CHECK(a.stats.regions == 1);
+
+    // Only the touched pages are backed by memory
+    CHECK(page_resident(big));
+    CHECK(!page_resident(&a.begin->data[a.begin->capacity/2]));
+
+    arena_free(&a);
+}
+
+// Run in a child process, because it limits the address space of the whole process
+static void test_reservation_fallback(void)
+{
+    pid_t pid = fork();
+    if (pid < 0) {
+        fprintf(stderr, "FAIL: could not fork: %s\n", strerror(errno));
+        failed += 1;
+        return;
+    }
+
+    if (pid == 0) {
+        failed = 0;
+        struct rlimit limit = {0};
+        getrlimit(RLIMIT_AS, &limit);
+        FILE *f = fopen("/proc/self/statm", "r");
+        unsigned long pages = 0;
+        if (f != NULL) {
+            if (fscanf(f, "%lu", &pages) != 1) pages = 0;
+            fclose(f);
+        }
+        CHECK(pages > 0);
+        // Enough for the regular regions, but not for the reservation
+        limit.rlim_cur = pages*page_size() + ARENA_MMAP_RESERVE/2;
+        CHECK(setrlimit(RLIMIT_AS, &limit) == 0);
+
+        Arena a = {0};
+        char *data = (char*)arena_alloc(&a, 100);
+        memset(data, 0x69, 100);
+        CHECK(a.begin != NULL);
+        CHECK(a.begin->capacity == REGION_DEFAULT_CAPACITY);
+        // The next region also falls back to the size that is needed
+        size_t size = 2*REGION_DEFAULT_CAPACITY*sizeof(uintptr_t);
+        arena_alloc(&a, size);
+        CHECK(a.stats.regions == 2);
+        CHECK(a.end->capacity == 2*REGION_DEFAULT_CAPACITY);
+        arena_free(&a);
+        _exit(failed > 0);
+    }
+
+    int wstatus = 0;
+    waitpid(pid, &wstatus, 0);
+    if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0) {
+        fprintf(stderr, "FAIL: reservation fallback\n");
+        failed += 1;
+    }
+}
+
+static void test_trim(void)
+{
+    size_t page = page_size();
+    Arena a = {0};
+    size_t size = 16*page;
+    unsigned char *data = (unsigned char*)arena_alloc(&a, size);
+    memset(data, 0x69, size);
+
+    // Keep the allocation ending in the middle of a page, that page has to survive the trim
+    Arena_Mark mark = arena_snapshot(&a);
+    arena_rewind(&a, (Arena_Mark) {mark.region, mark.count - (5*page + page/2)/sizeof(uintptr_t)});
+    unsigned char *end = (unsigned char*)&a.end->data[a.end->count];
+    size_t kept = end - data;
+    unsigned char *next_page = (unsigned char*)(((uintptr_t)end + page - 1) & ~(uintptr_t)(page - 1));
+
+    arena_trim(&a);
+
+    bool intact = true;
+    for (size_t i = 0; i < kept; ++i) intact = intact && data[i] == 0x69;
+    CHECK(intact);
+    CHECK(page_resident(end - 1));
+    // The rest of the partially used page is not given back
+    CHECK(end < next_page && *end == 0x69);
+    // The whole pages after the allocation are released and come back zeroed
+    CHECK(!page_resident(next_page));
+    CHECK(!page_resident(data + size - 1));
+    CHECK(data[size - 1] == 0);
+
+    // After a reset everything but the page with the region header goes back
+    arena_reset(&a);
+    arena_trim(&a);
+    CHECK(!page_resident(data + page));
+    CHECK(page_resident(a.begin));
+
+    arena_free(&a);
+}
+
+static void test_free_unmaps_reservation(void)
+{
+    Arena a = {0};
+    arena_alloc(&a, 1);
+    Region *r = a.begin;
+    char *first = (char*)r;
+    char *middle = (char*)&r->data[r->capacity/2];
+    char *last = (char*)&r->data[r->capacity] - 1;
+    CHECK(page_mapped(first));
+    CHECK(page_mapped(middle));
+    CHECK(page_mapped(last));
+
+    arena_free(&a);
+    CHECK(!page_mapped(first));
+    CHECK(!page_mapped(middle));
+    CHECK(!page_mapped(last));
+}
+
+int main(void)
+{
+    test_reservation();
+    test_reservation_fallback();
+    test_trim();
+    test_free_unmaps_reservation();
+
+    if (failed > 0) {
+        fprintf(stderr, "%zu arena checks failed\n", failed);
+        return 1;
+    }
+    printf("All arena checks passed\n");
+    return 0;
+}
+
+#define ARENA_IMPLEMENTATION
+#include "arena.h"
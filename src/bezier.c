@@ -228,7 +228,7 @@ void plug_update(Env env)
                 .y = -AXIS_LENGTH,
             };
             DrawLineEx(start_pos, end_pos, HANDLE_THICCNESS, RED);
-            float t = cuber_bezier_newton(x, p->nodes, 5);
+            float t = cuber_bezier_newton(x, p->nodes, 32);
             DrawCircleV(cubic_bezier(t, p->nodes), NODE_RADIUS, PURPLE);
         }
 
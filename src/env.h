@@ -1,15 +1,42 @@
 #ifndef ENV_H_
 #define ENV_H_
 
+#include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <raylib.h>
 
+// The exact time of the animation is counted in flicks, 1/705600000 of a second. A frame at every common
+// frame rate (24, 25, 30, 48, 50, 60, 90, 100, 120, 144...) and a sample at every common sample rate is a
+// whole amount of them, so adding frames up never drifts like adding up float seconds does.
+#define TICKS_PER_SECOND 705600000LL
+
+typedef int64_t Ticks;
+
+static inline Ticks ticks_from_secs(double secs)
+{
+    return (Ticks)llround(secs*TICKS_PER_SECOND);
+}
+
+static inline double secs_from_ticks(Ticks ticks)
+{
+    return (double)ticks/TICKS_PER_SECOND;
+}
+
 typedef struct {
     float delta_time;
+    // The clock of the animation. Restarts on every plug_reset(). delta_time is delta_ticks rounded to
+    // float, the tasks only look at the ticks, so the same animation always takes the same frames.
+    uint64_t frame;
+    Ticks time_ticks;           // Time at the beginning of this frame
+    Ticks delta_ticks;          // How much time passes during this frame
     float screen_width;
     float screen_height;
     bool rendering;
     void (*play_sound)(Sound sound, Wave wave);
+    // Profiling spans in the trace of the engine (see --trace). NULL when nobody is tracing.
+    void (*trace_begin)(const char *name);
+    void (*trace_end)(void);
 } Env;
 
 #endif // ENV_H_
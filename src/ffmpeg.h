@@ -6,10 +6,31 @@
 
 typedef struct FFMPEG FFMPEG;
 
-FFMPEG *ffmpeg_start_rendering_video(const char *output_path, size_t width, size_t height, size_t fps);
+// Pixel format of the frames in the pipe. FFMPEG_PIXEL_FORMAT_YUV420P converts the RGBA frames we
+// are given on our side, which is 2.67x less data through the pipe and no swscale in ffmpeg.
+typedef enum {
+    FFMPEG_PIXEL_FORMAT_RGBA,
+    FFMPEG_PIXEL_FORMAT_YUV420P,
+} FFMPEG_Pixel_Format;
+
+// How ffmpeg encodes the video. The values are passed to ffmpeg as they are.
+typedef struct {
+    const char *codec;   // -c:v
+    const char *preset;  // -preset, NULL leaves it up to the codec
+    const char *crf;     // -crf, takes precedence over the bitrate
+    const char *bitrate; // -b:v, used when crf is NULL
+} FFMPEG_Encoder;
+
+#define FFMPEG_DEFAULT_ENCODER ((FFMPEG_Encoder) { .codec = "libx264", .bitrate = "2500k" })
+
+// With audio set the sound sent through ffmpeg_send_sound_samples() is muxed into the same output file
+FFMPEG *ffmpeg_start_rendering_video(const char *output_path, size_t width, size_t height, size_t fps, FFMPEG_Pixel_Format pixel_format, FFMPEG_Encoder encoder, bool audio);
 FFMPEG *ffmpeg_start_rendering_audio(const char *output_path);
 bool ffmpeg_send_frame_flipped(FFMPEG *ffmpeg, void *data, size_t width, size_t height);
 bool ffmpeg_send_sound_samples(FFMPEG *ffmpeg, void *data, size_t size);
 bool ffmpeg_end_rendering(FFMPEG *ffmpeg, bool cancel);
+// Stitches video segments rendered with the same parameters into output_path without re-encoding
+// them and muxes the sound from audio_path in. Blocks until ffmpeg is done.
+bool ffmpeg_concat_segments(const char *output_path, const char **segment_paths, size_t segments_count, const char *audio_path);
 
 #endif // FFMPEG_H_
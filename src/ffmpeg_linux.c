@@ -1,74 +1,421 @@
+#define _GNU_SOURCE
 #include <assert.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <stdatomic.h>
 
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
 
 #include <raylib.h>
 
 #include "ffmpeg.h"
+#include "yuv.h"
+#include "trace.h"
 
 #define READ_END 0
 #define WRITE_END 1
 
-struct FFMPEG {
+// The file descriptor ffmpeg reads the sound from when it's rendered along with the video (pipe:3)
+#define FFMPEG_AUDIO_FD 3
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+
+// How many frames the render loop may get ahead of the encoder
+#ifndef FFMPEG_QUEUE_CAPACITY
+#define FFMPEG_QUEUE_CAPACITY 8
+#endif // FFMPEG_QUEUE_CAPACITY
+
+// Sound samples are queued in chunks of this size
+#define FFMPEG_AUDIO_SLOT_SIZE (16*1024)
+
+// Ask the kernel to back the frame slots with transparent huge pages
+#ifndef FFMPEG_HUGE_PAGES
+#define FFMPEG_HUGE_PAGES 1
+#endif // FFMPEG_HUGE_PAGES
+
+#define HUGE_PAGE_SIZE (2*1024*1024)
+
+// Hand the pages of the video frames to the pipe with vmsplice() instead of copying them with write()
+#ifndef FFMPEG_VMSPLICE
+#define FFMPEG_VMSPLICE 1
+#endif // FFMPEG_VMSPLICE
+
+typedef struct {
+    void *data;
+    size_t size;
+    bool stop;
+} Frame_Slot;
+
+// Single producer (render loop), single consumer (writer thread) ring of reusable frame buffers.
+// The indices are only ever advanced by their owner, the semaphores do the blocking when the
+// ring is full or empty.
+typedef struct {
+    Frame_Slot slots[FFMPEG_QUEUE_CAPACITY];
+    size_t frame_size;
+    size_t slot_capacity;
+    _Atomic size_t head;
+    _Atomic size_t tail;
+    sem_t free;
+    sem_t filled;
+
+    // Stats
+    size_t high_water_mark;
+    size_t frames;
+    double producer_blocked_secs;
+    double writer_blocked_secs;
+} Frame_Queue;
+
+// A thread that drains a Frame_Queue into a pipe. Video and audio get a writer each, so ffmpeg
+// waiting for more sound never gets stuck behind a half-written video frame and vice versa.
+typedef struct {
+    const char *name;
     int pipe;
+    bool splice;
+    bool running;
+    pthread_t thread;
+    atomic_bool failed;
+    atomic_bool cancel;
+    Frame_Queue queue;
+} Pipe_Writer;
+
+struct FFMPEG {
     pid_t pid;
+    FFMPEG_Pixel_Format pixel_format;
+    Pipe_Writer video;
+    Pipe_Writer audio;
 };
 
-FFMPEG *ffmpeg_start_rendering_video(const char *output_path, size_t width, size_t height, size_t fps)
+static double now_secs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+// write() is allowed to write less than asked (pipes do that for anything bigger than PIPE_BUF)
+// or to get interrupted by a signal, so we keep going until everything is in.
+static bool write_all(int fd, const void *data, size_t size)
+{
+    const uint8_t *bytes = data;
+    while (size > 0) {
+        ssize_t n = write(fd, bytes, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        bytes += n;
+        size -= n;
+    }
+    return true;
+}
+
+// vmsplice() only puts references to our pages into the pipe, so the bytes must stay untouched
+// until ffmpeg has read them. The pipe holds at most its size worth of pages, so once a frame at
+// least that big got into the pipe completely, everything before it has been read already.
+static bool vmsplice_all(int fd, const void *data, size_t size)
+{
+    struct iovec iov = {
+        .iov_base = (void*)data,
+        .iov_len = size,
+    };
+    while (iov.iov_len > 0) {
+        ssize_t n = vmsplice(fd, &iov, 1, 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        iov.iov_base = (uint8_t*)iov.iov_base + n;
+        iov.iov_len -= n;
+    }
+    return true;
+}
+
+static void *writer_thread(void *arg)
+{
+    Pipe_Writer *w = arg;
+    Frame_Queue *q = &w->queue;
+
+    // If ffmpeg dies we want write() to fail with EPIPE instead of the whole process getting killed
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+    char thread_name[64];
+    snprintf(thread_name, sizeof(thread_name), "ffmpeg %s writer", w->name);
+    trace_thread_name(thread_name);
+
+    // When splicing, the previous slot is given back to the render loop only after the
+    // current one is in the pipe (see vmsplice_all())
+    bool holding_previous = false;
+
+    for (;;) {
+        while (sem_wait(&q->filled) < 0 && errno == EINTR);
+        size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+        Frame_Slot *slot = &q->slots[head%FFMPEG_QUEUE_CAPACITY];
+        if (slot->stop) break;
+
+        // After a failure we keep draining the queue so the render loop never waits on us forever
+        if (!atomic_load(&w->failed) && !atomic_load(&w->cancel)) {
+            double start = now_secs();
+            trace_begin("write");
+            bool ok = w->splice
+                ? vmsplice_all(w->pipe, slot->data, slot->size)
+                : write_all(w->pipe, slot->data, slot->size);
+            if (!ok) {
+                TraceLog(LOG_ERROR, "FFMPEG: failed to write %s into ffmpeg pipe: %s", w->name, strerror(errno));
+                atomic_store(&w->failed, true);
+            }
+            trace_end();
+            q->writer_blocked_secs += now_secs() - start;
+        }
+
+        atomic_store_explicit(&q->head, head + 1, memory_order_release);
+        if (w->splice) {
+            if (holding_previous) sem_post(&q->free);
+            holding_previous = true;
+        } else {
+            sem_post(&q->free);
+        }
+    }
+
+    return NULL;
+}
+
+// The slots are allocated once per render straight from the kernel, page-aligned and pre-faulted, so the
+// render loop never hits the allocator or a fresh page while filling them.
+static void *alloc_slot(size_t capacity)
+{
+    void *data = mmap(NULL, capacity, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    assert(data != MAP_FAILED && "Buy MORE RAM lol!!");
+#if FFMPEG_HUGE_PAGES
+    if (capacity >= HUGE_PAGE_SIZE) madvise(data, capacity, MADV_HUGEPAGE);
+#endif // FFMPEG_HUGE_PAGES
+    memset(data, 0, capacity);
+    return data;
+}
+
+static size_t slot_capacity(size_t size)
+{
+    size_t page_size = sysconf(_SC_PAGESIZE);
+#if FFMPEG_HUGE_PAGES
+    if (size >= HUGE_PAGE_SIZE) page_size = HUGE_PAGE_SIZE;
+#endif // FFMPEG_HUGE_PAGES
+    return (size + page_size - 1)/page_size*page_size;
+}
+
+static void free_queue(Frame_Queue *q)
+{
+    for (size_t i = 0; i < FFMPEG_QUEUE_CAPACITY; ++i) {
+        munmap(q->slots[i].data, q->slot_capacity);
+    }
+    sem_destroy(&q->free);
+    sem_destroy(&q->filled);
+}
+
+static bool start_writer(Pipe_Writer *w, int pipe, size_t slot_size, bool splice)
 {
+    w->pipe = pipe;
+
+    // Holding back a single slot is only enough when one slot fills up the whole pipe
+    w->splice = false;
+    if (splice && FFMPEG_VMSPLICE) {
+        int pipe_size = fcntl(pipe, F_GETPIPE_SZ);
+        w->splice = pipe_size > 0 && slot_size >= (size_t)pipe_size;
+    }
+    TraceLog(LOG_INFO, "FFMPEG: sending %s to ffmpeg with %s", w->name, w->splice ? "vmsplice()" : "write()");
+
+    Frame_Queue *q = &w->queue;
+    memset(q, 0, sizeof(*q));
+    q->frame_size = slot_size;
+    q->slot_capacity = slot_capacity(slot_size);
+    for (size_t i = 0; i < FFMPEG_QUEUE_CAPACITY; ++i) {
+        q->slots[i].data = alloc_slot(q->slot_capacity);
+    }
+    sem_init(&q->free, 0, FFMPEG_QUEUE_CAPACITY);
+    sem_init(&q->filled, 0, 0);
+
+    atomic_store(&w->failed, false);
+    atomic_store(&w->cancel, false);
+    int ret = pthread_create(&w->thread, NULL, writer_thread, w);
+    if (ret != 0) {
+        TraceLog(LOG_ERROR, "FFMPEG: could not start %s writer thread: %s", w->name, strerror(ret));
+        free_queue(q);
+        return false;
+    }
+    w->running = true;
+    return true;
+}
+
+static Frame_Slot *queue_reserve(Frame_Queue *q)
+{
+    if (sem_trywait(&q->free) < 0) {
+        double start = now_secs();
+        trace_begin("ffmpeg queue full");
+        while (sem_wait(&q->free) < 0 && errno == EINTR);
+        trace_end();
+        q->producer_blocked_secs += now_secs() - start;
+    }
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    return &q->slots[tail%FFMPEG_QUEUE_CAPACITY];
+}
+
+static void queue_commit(Frame_Queue *q)
+{
+    size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed) + 1;
+    atomic_store_explicit(&q->tail, tail, memory_order_release);
+    size_t depth = tail - atomic_load_explicit(&q->head, memory_order_acquire);
+    if (depth > q->high_water_mark) q->high_water_mark = depth;
+    q->frames += 1;
+    sem_post(&q->filled);
+}
+
+static void stop_writer(Pipe_Writer *w)
+{
+    Frame_Queue *q = &w->queue;
+    Frame_Slot *slot = queue_reserve(q);
+    slot->stop = true;
+    queue_commit(q);
+    q->frames -= 1; // The stop marker is not a frame
+    pthread_join(w->thread, NULL);
+
+    TraceLog(LOG_INFO, "FFMPEG: %s queue: capacity %d, high-water mark %zu, %zu chunks", w->name, FFMPEG_QUEUE_CAPACITY, q->high_water_mark, q->frames);
+    TraceLog(LOG_INFO, "FFMPEG: %s buffer pool: %d x %zu bytes = %.1f MiB", w->name, FFMPEG_QUEUE_CAPACITY, q->slot_capacity, FFMPEG_QUEUE_CAPACITY*q->slot_capacity/(1024.0*1024.0));
+    TraceLog(LOG_INFO, "FFMPEG: render loop blocked on full %s queue for %.3fs, writer spent %.3fs sending", w->name, q->producer_blocked_secs, q->writer_blocked_secs);
+
+    free_queue(q);
+    w->running = false;
+}
+
+// Makes fd available in the child under the number target. The pipes are created with O_CLOEXEC so
+// everything we don't explicitly move this way is closed once ffmpeg is exec-ed.
+static bool reopen_fd_as(int fd, int target)
+{
+    if (fd == target) {
+        return fcntl(fd, F_SETFD, 0) >= 0;
+    }
+    return dup2(fd, target) >= 0;
+}
+
+static void close_pipe(int pipefd[2])
+{
+    close(pipefd[READ_END]);
+    close(pipefd[WRITE_END]);
+}
+
+static size_t frame_size(FFMPEG_Pixel_Format pixel_format, size_t width, size_t height)
+{
+    switch (pixel_format) {
+    case FFMPEG_PIXEL_FORMAT_RGBA:    return sizeof(uint32_t)*width*height;
+    case FFMPEG_PIXEL_FORMAT_YUV420P: return YUV420P_SIZE(width, height);
+    }
+    assert(0 && "unreachable");
+    return 0;
+}
+
+FFMPEG *ffmpeg_start_rendering_video(const char *output_path, size_t width, size_t height, size_t fps, FFMPEG_Pixel_Format pixel_format, FFMPEG_Encoder encoder, bool audio)
+{
+    if (pixel_format == FFMPEG_PIXEL_FORMAT_YUV420P && (width%2 != 0 || height%2 != 0)) {
+        TraceLog(LOG_WARNING, "FFMPEG: yuv420p requires even resolution, but got %zux%zu. Sending rgba instead.", width, height);
+        pixel_format = FFMPEG_PIXEL_FORMAT_RGBA;
+    }
+
     int pipefd[2];
+    int audiofd[2] = {-1, -1};
 
-    if (pipe(pipefd) < 0) {
+    if (pipe2(pipefd, O_CLOEXEC) < 0) {
         TraceLog(LOG_ERROR, "FFMPEG: Could not create a pipe: %s", strerror(errno));
         return NULL;
     }
 
+    if (audio && pipe2(audiofd, O_CLOEXEC) < 0) {
+        TraceLog(LOG_ERROR, "FFMPEG: Could not create a pipe for audio: %s", strerror(errno));
+        close_pipe(pipefd);
+        return NULL;
+    }
+
+    // Formatted before the fork, the child of a process with threads should not touch the heap
+    char resolution[64];
+    snprintf(resolution, sizeof(resolution), "%zux%zu", width, height);
+    char framerate[64];
+    snprintf(framerate, sizeof(framerate), "%zu", fps);
+
     pid_t child = fork();
     if (child < 0) {
         TraceLog(LOG_ERROR, "FFMPEG: could not fork a child: %s", strerror(errno));
+        close_pipe(pipefd);
+        if (audio) close_pipe(audiofd);
         return NULL;
     }
 
     if (child == 0) {
-        if (dup2(pipefd[READ_END], STDIN_FILENO) < 0) {
+        if (!reopen_fd_as(pipefd[READ_END], STDIN_FILENO)) {
             TraceLog(LOG_ERROR, "FFMPEG CHILD: could not reopen read end of pipe as stdin: %s", strerror(errno));
             exit(1);
         }
-        close(pipefd[WRITE_END]);
-
-        char resolution[64];
-        snprintf(resolution, sizeof(resolution), "%zux%zu", width, height);
-        char framerate[64];
-        snprintf(framerate, sizeof(framerate), "%zu", fps);
+        if (audio && !reopen_fd_as(audiofd[READ_END], FFMPEG_AUDIO_FD)) {
+            TraceLog(LOG_ERROR, "FFMPEG CHILD: could not reopen read end of audio pipe as fd %d: %s", FFMPEG_AUDIO_FD, strerror(errno));
+            exit(1);
+        }
 
-        int ret = execlp("ffmpeg",
-            "ffmpeg",
 
-            "-loglevel", "verbose",
-            "-y",
+        const char *args[64];
+        size_t args_count = 0;
+        #define ARGS(...) \
+            do { \
+                const char *new_args[] = {__VA_ARGS__}; \
+                for (size_t i = 0; i < sizeof(new_args)/sizeof(new_args[0]); ++i) { \
+                    assert(args_count < sizeof(args)/sizeof(args[0])); \
+                    args[args_count++] = new_args[i]; \
+                } \
+            } while (0)
+
+        ARGS("ffmpeg",
+             "-loglevel", "verbose",
+             "-y");
+
+        ARGS("-f", "rawvideo",
+             "-pix_fmt", pixel_format == FFMPEG_PIXEL_FORMAT_YUV420P ? "yuv420p" : "rgba",
+             "-s", resolution,
+             "-r", framerate,
+             "-i", "-");
+
+        if (audio) {
+            ARGS("-f", "s16le",
+                 "-sample_rate", "44100",
+                 "-channels", "2",
+                 "-i", "pipe:" STR(FFMPEG_AUDIO_FD));
+        }
 
-            "-f", "rawvideo",
-            "-pix_fmt", "rgba",
-            "-s", resolution,
-            "-r", framerate,
-            "-i", "-",
+        ARGS("-c:v", encoder.codec);
+        if (encoder.preset != NULL) ARGS("-preset", encoder.preset);
+        if (encoder.crf != NULL) {
+            ARGS("-crf", encoder.crf);
+        } else if (encoder.bitrate != NULL) {
+            ARGS("-b:v", encoder.bitrate);
+        }
 
-            "-c:v", "libx264",
-            "-vb", "2500k",
-            "-c:a", "aac",
-            "-ab", "200k",
-            "-pix_fmt", "yuv420p",
-            output_path,
+        ARGS("-c:a", "aac",
+             "-ab", "200k",
+             "-pix_fmt", "yuv420p",
+             output_path,
+             NULL);
+        #undef ARGS
 
-            NULL
-        );
+        int ret = execvp("ffmpeg", (char * const*)args);
         if (ret < 0) {
             TraceLog(LOG_ERROR, "FFMPEG CHILD: could not run ffmpeg as a child process: %s", strerror(errno));
             exit(1);
@@ -80,11 +427,24 @@ FFMPEG *ffmpeg_start_rendering_video(const char *output_path, size_t width, size
     if (close(pipefd[READ_END]) < 0) {
         TraceLog(LOG_WARNING, "FFMPEG: could not close read end of the pipe on the parent's end: %s", strerror(errno));
     }
+    if (audio && close(audiofd[READ_END]) < 0) {
+        TraceLog(LOG_WARNING, "FFMPEG: could not close read end of the audio pipe on the parent's end: %s", strerror(errno));
+    }
 
     FFMPEG *ffmpeg = malloc(sizeof(FFMPEG));
     assert(ffmpeg != NULL && "Buy MORE RAM lol!!");
+    memset(ffmpeg, 0, sizeof(*ffmpeg));
+    ffmpeg->video.name = "video";
+    ffmpeg->audio.name = "audio";
     ffmpeg->pid = child;
-    ffmpeg->pipe = pipefd[WRITE_END];
+    ffmpeg->pixel_format = pixel_format;
+    ffmpeg->video.pipe = pipefd[WRITE_END];
+    ffmpeg->audio.pipe = audiofd[WRITE_END];
+    if (!start_writer(&ffmpeg->video, pipefd[WRITE_END], frame_size(pixel_format, width, height), true) ||
+        (audio && !start_writer(&ffmpeg->audio, audiofd[WRITE_END], FFMPEG_AUDIO_SLOT_SIZE, false))) {
+        ffmpeg_end_rendering(ffmpeg, true);
+        return NULL;
+    }
     return ffmpeg;
 }
 
@@ -92,7 +452,7 @@ FFMPEG *ffmpeg_start_rendering_audio(const char *output_path)
 {
     int pipefd[2];
 
-    if (pipe(pipefd) < 0) {
+    if (pipe2(pipefd, O_CLOEXEC) < 0) {
         TraceLog(LOG_ERROR, "FFMPEG: Could not create a pipe: %s", strerror(errno));
         return NULL;
     }
@@ -100,15 +460,15 @@ FFMPEG *ffmpeg_start_rendering_audio(const char *output_path)
     pid_t child = fork();
     if (child < 0) {
         TraceLog(LOG_ERROR, "FFMPEG: could not fork a child: %s", strerror(errno));
+        close_pipe(pipefd);
         return NULL;
     }
 
     if (child == 0) {
-        if (dup2(pipefd[READ_END], STDIN_FILENO) < 0) {
+        if (!reopen_fd_as(pipefd[READ_END], STDIN_FILENO)) {
             TraceLog(LOG_ERROR, "FFMPEG CHILD: could not reopen read end of pipe as stdin: %s", strerror(errno));
             exit(1);
         }
-        close(pipefd[WRITE_END]);
 
         int ret = execlp("ffmpeg",
             "ffmpeg",
@@ -140,24 +500,21 @@ FFMPEG *ffmpeg_start_rendering_audio(const char *output_path)
 
     FFMPEG *ffmpeg = malloc(sizeof(FFMPEG));
     assert(ffmpeg != NULL && "Buy MORE RAM lol!!");
+    memset(ffmpeg, 0, sizeof(*ffmpeg));
+    ffmpeg->video.name = "video";
+    ffmpeg->audio.name = "audio";
     ffmpeg->pid = child;
-    ffmpeg->pipe = pipefd[WRITE_END];
+    ffmpeg->video.pipe = -1;
+    ffmpeg->audio.pipe = pipefd[WRITE_END];
+    if (!start_writer(&ffmpeg->audio, pipefd[WRITE_END], FFMPEG_AUDIO_SLOT_SIZE, false)) {
+        ffmpeg_end_rendering(ffmpeg, true);
+        return NULL;
+    }
     return ffmpeg;
 }
 
-bool ffmpeg_end_rendering(FFMPEG *ffmpeg, bool cancel)
+static bool wait_for_ffmpeg(pid_t pid)
 {
-    int pipe = ffmpeg->pipe;
-    pid_t pid = ffmpeg->pid;
-
-    free(ffmpeg);
-
-    if (close(pipe) < 0) {
-        TraceLog(LOG_WARNING, "FFMPEG: could not close write end of the pipe on the parent's end: %s", strerror(errno));
-    }
-
-    if (cancel) kill(pid, SIGKILL);
-
     for (;;) {
         int wstatus = 0;
         if (waitpid(pid, &wstatus, 0) < 0) {
@@ -184,23 +541,149 @@ bool ffmpeg_end_rendering(FFMPEG *ffmpeg, bool cancel)
     assert(0 && "unreachable");
 }
 
+static void end_writer(Pipe_Writer *w)
+{
+    if (w->running) stop_writer(w);
+    if (w->pipe >= 0 && close(w->pipe) < 0) {
+        TraceLog(LOG_WARNING, "FFMPEG: could not close write end of the %s pipe on the parent's end: %s", w->name, strerror(errno));
+    }
+}
+
+bool ffmpeg_end_rendering(FFMPEG *ffmpeg, bool cancel)
+{
+    pid_t pid = ffmpeg->pid;
+
+    if (cancel) {
+        // Killing ffmpeg first unblocks the writers if they are stuck in write()
+        atomic_store(&ffmpeg->video.cancel, true);
+        atomic_store(&ffmpeg->audio.cancel, true);
+        kill(pid, SIGKILL);
+    }
+    end_writer(&ffmpeg->video);
+    end_writer(&ffmpeg->audio);
+
+    free(ffmpeg);
+
+    return wait_for_ffmpeg(pid);
+}
+
 bool ffmpeg_send_frame_flipped(FFMPEG *ffmpeg, void *data, size_t width, size_t height)
 {
-    for (size_t y = height; y > 0; --y) {
-        // TODO: write() may not necessarily write the entire row. We may want to repeat the call.
-        if (write(ffmpeg->pipe, (uint32_t*)data + (y - 1)*width, sizeof(uint32_t)*width) < 0) {
-            TraceLog(LOG_ERROR, "FFMPEG: failed to write frame into ffmpeg pipe: %s", strerror(errno));
-            return false;
+    Pipe_Writer *w = &ffmpeg->video;
+    assert(w->running && "Only video renders accept frames");
+    if (atomic_load(&w->failed)) return false;
+
+    Frame_Queue *q = &w->queue;
+    assert(frame_size(ffmpeg->pixel_format, width, height) == q->frame_size);
+    Frame_Slot *slot = queue_reserve(q);
+    // Flipping once into a contiguous buffer lets the writer submit the whole frame at once
+    switch (ffmpeg->pixel_format) {
+    case FFMPEG_PIXEL_FORMAT_RGBA: {
+        size_t stride = sizeof(uint32_t)*width;
+        for (size_t y = 0; y < height; ++y) {
+            memcpy((uint8_t*)slot->data + y*stride, (uint8_t*)data + (height - y - 1)*stride, stride);
         }
+    } break;
+    case FFMPEG_PIXEL_FORMAT_YUV420P: {
+        rgba_flipped_to_yuv420p(data, width, height, slot->data);
+    } break;
     }
+    slot->size = q->frame_size;
+    slot->stop = false;
+    queue_commit(q);
     return true;
 }
 
 bool ffmpeg_send_sound_samples(FFMPEG *ffmpeg, void *data, size_t size)
 {
-    if (write(ffmpeg->pipe, data, size) < 0) {
-        TraceLog(LOG_ERROR, "FFMPEG: failed to write sound into ffmpeg pipe: %s", strerror(errno));
+    Pipe_Writer *w = &ffmpeg->audio;
+    if (!w->running) {
+        TraceLog(LOG_ERROR, "FFMPEG: this rendering does not accept sound");
         return false;
     }
+    if (atomic_load(&w->failed)) return false;
+
+    Frame_Queue *q = &w->queue;
+    while (size > 0) {
+        size_t n = size < q->frame_size ? size : q->frame_size;
+        Frame_Slot *slot = queue_reserve(q);
+        memcpy(slot->data, data, n);
+        slot->size = n;
+        slot->stop = false;
+        queue_commit(q);
+        data = (uint8_t*)data + n;
+        size -= n;
+    }
     return true;
 }
+
+bool ffmpeg_concat_segments(const char *output_path, const char **segment_paths, size_t segments_count, const char *audio_path)
+{
+    // The concat demuxer resolves relative paths against the list file, so we give it absolute ones
+    char list_path[] = "/tmp/panim-concat-XXXXXX";
+    int list_fd = mkstemp(list_path);
+    if (list_fd < 0) {
+        TraceLog(LOG_ERROR, "FFMPEG: could not create concat list: %s", strerror(errno));
+        return false;
+    }
+    FILE *list = fdopen(list_fd, "w");
+    assert(list != NULL);
+    for (size_t i = 0; i < segments_count; ++i) {
+        char *path = realpath(segment_paths[i], NULL);
+        if (path == NULL) {
+            TraceLog(LOG_ERROR, "FFMPEG: could not find segment %s: %s", segment_paths[i], strerror(errno));
+            fclose(list);
+            unlink(list_path);
+            return false;
+        }
+        fprintf(list, "file '");
+        for (const char *c = path; *c; ++c) {
+            if (*c == '\'') fprintf(list, "'\\''");
+            else fputc(*c, list);
+        }
+        fprintf(list, "'\n");
+        free(path);
+    }
+    fclose(list);
+
+    pid_t child = fork();
+    if (child < 0) {
+        TraceLog(LOG_ERROR, "FFMPEG: could not fork a child: %s", strerror(errno));
+        unlink(list_path);
+        return false;
+    }
+
+    if (child == 0) {
+        // The video is copied as is, only the sound gets encoded here
+        int ret = execlp("ffmpeg",
+            "ffmpeg",
+
+            "-loglevel", "verbose",
+            "-y",
+
+            "-f", "concat",
+            "-safe", "0",
+            "-i", list_path,
+            "-i", audio_path,
+
+            "-map", "0:v",
+            "-map", "1:a",
+            "-c:v", "copy",
+            "-c:a", "aac",
+            "-ab", "200k",
+            output_path,
+
+            NULL
+        );
+        if (ret < 0) {
+            TraceLog(LOG_ERROR, "FFMPEG CHILD: could not run ffmpeg as a child process: %s", strerror(errno));
+            exit(1);
+        }
+        assert(0 && "unreachable");
+        exit(1);
+    }
+
+    bool ok = wait_for_ffmpeg(child);
+    unlink(list_path);
+    return ok;
+}
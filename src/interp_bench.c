@@ -0,0 +1,99 @@
+// Compares the exact easing functions against their lookup table versions: throughput of both
+// and the maximum error of the table. Build with ./nob and run ./build/interp_bench [samples]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "interp_lut.h"
+
+#define DEFAULT_SAMPLES (1000*1000)
+#define ERROR_SAMPLES (1000*1000)
+#define REPEATS 20
+
+static double now_secs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+// The input has to be random enough so the branch predictor and the cache do not make the
+// table lookups look better than they are in the real tasks
+static uint32_t xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+typedef float (*Interp_Eval)(Interp_Func func, float t);
+
+static float eval_exact(Interp_Func func, float t)
+{
+    return interp_func(func, t);
+}
+
+static float eval_lut(Interp_Func func, float t)
+{
+    return interp_func_table(func, t);
+}
+
+// Best of REPEATS runs in nanoseconds per evaluation
+static double measure(Interp_Eval eval, Interp_Func func, const float *ts, size_t count, volatile float *sink)
+{
+    double best = 0;
+    for (size_t r = 0; r < REPEATS; ++r) {
+        float acc = 0;
+        double start = now_secs();
+        for (size_t i = 0; i < count; ++i) acc += eval(func, ts[i]);
+        double elapsed = now_secs() - start;
+        *sink = acc;
+        if (r == 0 || elapsed < best) best = elapsed;
+    }
+    return best/count*1e9;
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = DEFAULT_SAMPLES;
+    if (argc > 1) {
+        count = strtoul(argv[1], NULL, 10);
+        if (count == 0) {
+            fprintf(stderr, "Usage: %s [samples]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    float *ts = malloc(sizeof(*ts)*count);
+    if (ts == NULL) {
+        fprintf(stderr, "ERROR: could not allocate %zu samples\n", count);
+        return 1;
+    }
+    uint32_t state = 0x1337;
+    for (size_t i = 0; i < count; ++i) ts[i] = (float)xorshift32(&state)/(float)UINT32_MAX;
+
+    volatile float sink = 0;
+    printf("%zu samples, %d table segments, best of %d runs\n", count, INTERP_LUT_SIZE, REPEATS);
+    printf("%-12s %12s %12s %9s %12s %s\n", "func", "exact ns/op", "table ns/op", "speedup", "max error", "");
+    for (int func = 0; func < COUNT_INTERP_FUNCS; ++func) {
+        double exact = measure(eval_exact, (Interp_Func)func, ts, count, &sink);
+        double lut = measure(eval_lut, (Interp_Func)func, ts, count, &sink);
+
+        double max_error = 0;
+        for (size_t i = 0; i <= ERROR_SAMPLES; ++i) {
+            float t = (float)i/ERROR_SAMPLES;
+            double error = fabs((double)interp_func((Interp_Func)func, t) - (double)interp_func_table((Interp_Func)func, t));
+            if (error > max_error) max_error = error;
+        }
+
+        printf("%-12s %12.3f %12.3f %8.2fx %12.3e %s\n",
+               interp_func_name((Interp_Func)func), exact, lut, exact/lut, max_error,
+               interp_func_tabulated((Interp_Func)func) ? "(interp_func_lut uses the table)" : "");
+    }
+
+    free(ts);
+    return 0;
+}
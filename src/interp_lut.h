@@ -0,0 +1,43 @@
+#ifndef INTERP_LUT_H_
+#define INTERP_LUT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "interpolators.h"
+#include "interp_luts.h" // Generated by nob into the build folder from src/interp_luts_gen.c
+
+// Linearly interpolates a table of INTERP_LUT_SIZE + 1 uniformly spaced samples of a function on
+// [0, 1]. t is clamped to [0, 1].
+static inline float interp_lut_eval(const float *lut, float t)
+{
+    if (!(t > 0.0f)) t = 0.0f; // Also catches NaN
+    if (t > 1.0f) t = 1.0f;
+    float x = t*INTERP_LUT_SIZE;
+    size_t i = (size_t)x;
+    if (i >= INTERP_LUT_SIZE) return lut[INTERP_LUT_SIZE];
+    float frac = x - (float)i;
+    return lut[i] + (lut[i + 1] - lut[i])*frac;
+}
+
+static inline float interp_func_table(Interp_Func func, float t)
+{
+    return interp_lut_eval(interp_luts[func], t);
+}
+
+// Same as interp_func() but the sine based functions are linearly interpolated from the
+// precomputed tables instead of calling sinf() on every frame of every move task. The rest are
+// already a couple of multiplications (or a single sqrtss) which is cheaper than the table
+// lookup, so they are evaluated exactly. See `build/interp_bench` for the speed and the error.
+static inline bool interp_func_tabulated(Interp_Func func)
+{
+    return func == FUNC_SINSTEP || func == FUNC_SINPULSE;
+}
+
+static inline float interp_func_lut(Interp_Func func, float t)
+{
+    if (interp_func_tabulated(func)) return interp_func_table(func, t);
+    return interp_func(func, t);
+}
+
+#endif // INTERP_LUT_H_
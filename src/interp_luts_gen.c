@@ -0,0 +1,54 @@
+// Generates the easing lookup tables used by interp_func_lut() (see interp_lut.h). Run by nob
+// at build time, so the tables are always sampled from the current interpolators.h.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "interpolators.h"
+
+// Amount of segments in every table. 1024 keeps the error of the linear interpolation below
+// 1e-6 for the sine based functions while all of the tables still fit into L1 cache.
+#define INTERP_LUT_SIZE 1024
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <output.h>\n", argv[0]);
+        return 1;
+    }
+    const char *output_path = argv[1];
+
+    FILE *f = fopen(output_path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "ERROR: could not open %s: %s\n", output_path, strerror(errno));
+        return 1;
+    }
+
+    fprintf(f, "// Generated by src/interp_luts_gen.c. DO NOT EDIT!\n");
+    fprintf(f, "#ifndef INTERP_LUTS_H_\n");
+    fprintf(f, "#define INTERP_LUTS_H_\n\n");
+    fprintf(f, "#define INTERP_LUT_SIZE %d\n\n", INTERP_LUT_SIZE);
+    fprintf(f, "static const float interp_luts[COUNT_INTERP_FUNCS][INTERP_LUT_SIZE + 1] = {\n");
+    for (int func = 0; func < COUNT_INTERP_FUNCS; ++func) {
+        fprintf(f, "    // %s\n", interp_func_name((Interp_Func)func));
+        fprintf(f, "    {");
+        for (int i = 0; i <= INTERP_LUT_SIZE; ++i) {
+            if (i%8 == 0) fprintf(f, "\n        ");
+            // The last sample is the value at t = 1
+            float t = (float)i/INTERP_LUT_SIZE;
+            // 9 significant digits are enough to get the exact same float back
+            fprintf(f, "%.9ef, ", interp_func((Interp_Func)func, t));
+        }
+        fprintf(f, "\n    },\n");
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "#endif // INTERP_LUTS_H_\n");
+
+    if (fclose(f) != 0) {
+        fprintf(stderr, "ERROR: could not write %s: %s\n", output_path, strerror(errno));
+        return 1;
+    }
+
+    return 0;
+}
@@ -12,6 +12,10 @@ typedef enum {
     FUNC_SQR,
     FUNC_SQRT,
     FUNC_SINPULSE,
+    COUNT_INTERP_FUNCS,
+    // The custom easings of tasks.h take the values after the builtin ones. Without this the values of
+    // the enum only span the builtin ones in C++ and the custom ones would not fit into it.
+    FUNC_CUSTOM_MAX = 0x7FFFFFFF,
 } Interp_Func;
 
 static inline float smoothstep(float x)
@@ -57,11 +61,26 @@ static inline Vector2 cubic_bezier_der(float t, Vector2 nodes[4])
     return b;
 }
 
+// Finds t of the point on the curve with the given x. x of the curve must not decrease from nodes[0]
+// to nodes[3]. Newton's method, but every step that leaves the bracket around the root (or comes from
+// a too flat derivative) is replaced with bisection, and it stops as soon as it converged, so n is
+// only the upper bound of the iterations.
 static inline float cuber_bezier_newton(float x, Vector2 nodes[4], size_t n)
 {
-    float t = 0;
+    float width = nodes[3].x - nodes[0].x;
+    if (width <= 0) return 0;
+    float tolerance = width*1e-6f;
+    float lo = 0;
+    float hi = 1;
+    float t = Clamp((x - nodes[0].x)/width, 0, 1);
     for (size_t i = 0; i < n; ++i) {
-        t = t - (cubic_bezier(t, nodes).x - x)/cubic_bezier_der(t, nodes).x;
+        float dx = cubic_bezier(t, nodes).x - x;
+        if (fabsf(dx) <= tolerance) break;
+        if (dx < 0) lo = t; else hi = t;
+        float d = cubic_bezier_der(t, nodes).x;
+        float next = fabsf(d) > tolerance ? t - dx/d : lo;
+        if (next <= lo || next >= hi) next = (lo + hi)*0.5f;
+        t = next;
     }
     return t;
 }
@@ -75,9 +94,27 @@ static inline float interp_func(Interp_Func func, float t)
     case FUNC_SINSTEP:    return sinstep(t);
     case FUNC_SMOOTHSTEP: return smoothstep(t);
     case FUNC_SINPULSE:   return sinpulse(t);
+    case COUNT_INTERP_FUNCS:
+    case FUNC_CUSTOM_MAX: break;
     }
     assert(0 && "UNREACHABLE");
     return 0.0f;
 }
 
+static inline const char *interp_func_name(Interp_Func func)
+{
+    switch (func) {
+    case FUNC_ID:         return "id";
+    case FUNC_SQR:        return "sqr";
+    case FUNC_SQRT:       return "sqrt";
+    case FUNC_SINSTEP:    return "sinstep";
+    case FUNC_SMOOTHSTEP: return "smoothstep";
+    case FUNC_SINPULSE:   return "sinpulse";
+    case COUNT_INTERP_FUNCS:
+    case FUNC_CUSTOM_MAX: break;
+    }
+    assert(0 && "UNREACHABLE");
+    return NULL;
+}
+
 #endif // INTERPOLATORS_H_
@@ -0,0 +1,111 @@
+#include <string.h>
+
+#include <raylib.h>
+
+#include "mixer.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MIXER_X86
+#include <immintrin.h>
+#endif
+
+typedef void (*Add_Func)(int16_t *dst, const int16_t *src, size_t count);
+
+static void add_scalar(int16_t *dst, const int16_t *src, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        int32_t sum = (int32_t)dst[i] + src[i];
+        if (sum > INT16_MAX) sum = INT16_MAX;
+        if (sum < INT16_MIN) sum = INT16_MIN;
+        dst[i] = sum;
+    }
+}
+
+#ifdef MIXER_X86
+
+__attribute__((target("sse2")))
+static void add_sse2(int16_t *dst, const int16_t *src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_adds_epi16(a, b));
+    }
+    add_scalar(dst + i, src + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static void add_avx2(int16_t *dst, const int16_t *src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(dst + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_adds_epi16(a, b));
+    }
+    add_scalar(dst + i, src + i, count - i);
+}
+
+#endif // MIXER_X86
+
+static Add_Func pick_add_func(void)
+{
+#ifdef MIXER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return add_avx2;
+    if (__builtin_cpu_supports("sse2")) return add_sse2;
+#endif // MIXER_X86
+    return add_scalar;
+}
+
+void mixer_clear(Mixer *mixer)
+{
+    mixer->voices_count = 0;
+}
+
+void mixer_play(Mixer *mixer, const int16_t *samples, size_t count)
+{
+    if (count == 0) return;
+
+    Mixer_Voice voice = {
+        .samples = samples,
+        .count = count,
+    };
+
+    if (mixer->voices_count < MIXER_CAPACITY) {
+        mixer->voices[mixer->voices_count++] = voice;
+        return;
+    }
+
+    size_t victim = 0;
+    for (size_t i = 1; i < mixer->voices_count; ++i) {
+        Mixer_Voice *it = &mixer->voices[i];
+        Mixer_Voice *best = &mixer->voices[victim];
+        if (it->count - it->cursor < best->count - best->cursor) victim = i;
+    }
+    TraceLog(LOG_WARNING, "MIXER: more than %d sounds at the same time, cutting one of them off", MIXER_CAPACITY);
+    mixer->voices[victim] = voice;
+}
+
+void mixer_mix(Mixer *mixer, int16_t *out, size_t count)
+{
+    static Add_Func add = NULL;
+    if (add == NULL) add = pick_add_func();
+
+    memset(out, 0, count*sizeof(*out));
+
+    for (size_t i = 0; i < mixer->voices_count;) {
+        Mixer_Voice *voice = &mixer->voices[i];
+        size_t n = voice->count - voice->cursor;
+        if (n > count) n = count;
+        add(out, voice->samples + voice->cursor, n);
+        voice->cursor += n;
+
+        if (voice->cursor >= voice->count) {
+            *voice = mixer->voices[--mixer->voices_count];
+        } else {
+            i += 1;
+        }
+    }
+}
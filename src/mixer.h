@@ -0,0 +1,32 @@
+#ifndef MIXER_H_
+#define MIXER_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// How many sounds can play at the same time. When it's full a new sound replaces the one closest to its end.
+#ifndef MIXER_CAPACITY
+#define MIXER_CAPACITY 32
+#endif // MIXER_CAPACITY
+
+typedef struct {
+    const int16_t *samples;
+    size_t count;
+    size_t cursor;
+} Mixer_Voice;
+
+// Mixes any amount of overlapping signed 16 bit sounds into blocks of samples. The mixer only
+// counts samples, so the sounds and the blocks must agree on the amount of channels.
+typedef struct {
+    Mixer_Voice voices[MIXER_CAPACITY];
+    size_t voices_count;
+} Mixer;
+
+void mixer_clear(Mixer *mixer);
+// The samples are not copied and have to stay alive until the sound is done playing
+void mixer_play(Mixer *mixer, const int16_t *samples, size_t count);
+// Overwrites out with the saturated sum of the next count samples of all playing sounds
+void mixer_mix(Mixer *mixer, int16_t *out, size_t count);
+
+#endif // MIXER_H_
@@ -6,45 +6,130 @@
 #include <raymath.h>
 
 #include <dlfcn.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
 
 #define NOB_IMPLEMENTATION
 #include "nob.h"
 #include "plug.h"
 #include "ffmpeg.h"
+#include "readback.h"
+#include "render_stats.h"
+#include "trace.h"
+#include "mixer.h"
 
-// #define FFMPEG_VIDEO_WIDTH 1600
-// #define FFMPEG_VIDEO_HEIGHT 900
-// #define FFMPEG_VIDEO_FPS 30
+// Defaults of the render config, see render_config below
 #define FFMPEG_VIDEO_WIDTH 1920
 #define FFMPEG_VIDEO_HEIGHT 1080
 #define FFMPEG_VIDEO_FPS 60
-#define FFMPEG_VIDEO_DELTA_TIME (1.0f/FFMPEG_VIDEO_FPS)
+#define FFMPEG_VIDEO_PIXEL_FORMAT FFMPEG_PIXEL_FORMAT_YUV420P
 #define FFMPEG_SOUND_SAMPLE_RATE 44100
 #define FFMPEG_SOUND_CHANNELS 2
 #define FFMPEG_SOUND_SAMPLE_SIZE_BITS 16
 #define FFMPEG_SOUND_SAMPLE_SIZE_BYTES (FFMPEG_SOUND_SAMPLE_SIZE_BITS/8)
-// SPF - Samples Per Frame
-#define FFMPEG_SOUND_SPF (FFMPEG_SOUND_SAMPLE_RATE/FFMPEG_VIDEO_FPS)
+#define FFMPEG_SOUND_FRAME_SIZE (FFMPEG_SOUND_SAMPLE_SIZE_BYTES*FFMPEG_SOUND_CHANNELS)
 #define RENDERING_FONT_SIZE 78
+// While rendering the window is refreshed only this often (in seconds), frames are produced as fast as possible in between
+#define RENDERING_UI_REFRESH_INTERVAL 0.1
+#define PREVIEW_FPS 60
+#define SNAPSHOT_INTERVAL_SECS 1   // How often the preview takes a snapshot of the plugins that support them
+#define SNAPSHOTS_CAPACITY 256     // When there are that many, every other one is dropped and the interval doubles
+#define JUMP_BACK_SECS 5
 #define POPUP_DISAPPER_TIME 1.5f
+// Parallel rendering hands out the timeline to the workers in chunks of this many seconds by default
+#define PARALLEL_CHUNK_SECS 5
+// Resolution and encoder settings of --draft
+#define DRAFT_WIDTH 640
+#define DRAFT_HEIGHT 360
+#define DRAFT_PRESET "ultrafast"
+
+typedef struct {
+    size_t width;
+    size_t height;
+    size_t fps;
+    FFMPEG_Encoder encoder;
+} Render_Config;
+
+// Waves the animation played during rendering converted into the format of the exported sound
+typedef struct {
+    Wave source; // Only the pointer to the samples and the format are compared, the samples are not owned
+    Wave wave;
+} Converted_Wave;
+
+typedef struct {
+    Converted_Wave *items;
+    size_t count;
+    size_t capacity;
+} Converted_Waves;
+
+// Keyframe of the preview, jumping back replays the animation only from the closest one
+typedef struct {
+    uint64_t frame;
+    Ticks time;
+    void *data; // From plug_snapshot()
+} Snapshot;
+
+typedef struct {
+    Snapshot *items;
+    size_t count;
+    size_t capacity;
+} Snapshots;
+
+typedef struct {
+    float delta_time;
+    Ticks delta_ticks;
+} Preview_Frame;
+
+// Every frame the preview has shown since the animation was reset, so jumping back replays exactly
+// the same frames instead of landing on a state that was never on the screen
+typedef struct {
+    Preview_Frame *items;
+    size_t count;
+    size_t capacity;
+} Preview_Frames;
 
 // The state of Panim Engine
+static Render_Config render_config = {
+    .width = FFMPEG_VIDEO_WIDTH,
+    .height = FFMPEG_VIDEO_HEIGHT,
+    .fps = FFMPEG_VIDEO_FPS,
+    .encoder = FFMPEG_DEFAULT_ENCODER,
+};
 static bool paused = false;
 static FFMPEG *ffmpeg_video = NULL;
+static bool ffmpeg_video_sound = false;
 static FFMPEG *ffmpeg_audio = NULL;
+static Readback *readback = NULL;
+static Render_Stats *render_stats = NULL;
+static const char *render_stats_csv_path = NULL;
+// plug_seek() has to land on exactly the same state as updating frame by frame, otherwise the chunks of a
+// parallel render don't line up. --no-seek replays the frames instead for plugins that can't promise that.
+static bool use_plug_seek = true;
 static RenderTexture2D screen = {0};
 static Font rendering_font = {0};
 static void *libplug = NULL;
-static Wave ffmpeg_wave = {0};
-static size_t ffmpeg_wave_cursor = 0;
-static uint8_t silence[FFMPEG_SOUND_SPF*FFMPEG_SOUND_SAMPLE_SIZE_BYTES*FFMPEG_SOUND_CHANNELS] = {0};
+static Mixer ffmpeg_mixer = {0};
+static Converted_Waves converted_waves = {0};
+static size_t ffmpeg_sound_frames = 0; // How many video frames worth of sound were sent
+static int16_t *ffmpeg_sound_block = NULL; // One video frame worth of mixed samples
+static size_t ffmpeg_sound_block_capacity = 0;
+
+static uint64_t clock_frame = 0; // The clock of the animation (see Env), restarts with the animation
+static Ticks clock_ticks = 0;
+static Snapshots snapshots = {0};
+static Ticks snapshot_interval = SNAPSHOT_INTERVAL_SECS*TICKS_PER_SECOND;
+static Preview_Frames preview_frames = {0};
 
 static float delta_time_multiplier = 1.0f;
 static float delta_time_multiplier_popup = 0.0f;
 
 #define PLUG(name, ret, ...) static ret (*name)(__VA_ARGS__);
 LIST_OF_PLUGS
+LIST_OF_OPTIONAL_PLUGS
 #undef PLUG
+static size_t *task_update_count = NULL; // See tasks.h, the plugins that don't use tasks don't export it
 
 static bool reload_libplug(const char *libplug_path)
 {
@@ -67,51 +152,67 @@ static bool reload_libplug(const char *libplug_path)
     LIST_OF_PLUGS
     #undef PLUG
 
+    #define PLUG(name, ...) name = dlsym(libplug, #name);
+    LIST_OF_OPTIONAL_PLUGS
+    #undef PLUG
+    task_update_count = dlsym(libplug, "task_update_count");
+
     return true;
 }
 
-static void finish_ffmpeg_video_rendering(bool cancel)
+// The converted waves are keyed by the pointer to the original samples, which is only meaningful
+// until the plugin unloads the wave, so the cache lives for a single rendering at most
+static void clear_converted_waves(void)
 {
-    SetTraceLogLevel(LOG_INFO);
-    ffmpeg_end_rendering(ffmpeg_video, cancel);
-    plug_reset();
-    paused = true;
-    ffmpeg_video = NULL;
+    for (size_t i = 0; i < converted_waves.count; ++i) {
+        UnloadWave(converted_waves.items[i].wave);
+    }
+    converted_waves.count = 0;
 }
 
-static void finish_ffmpeg_audio_rendering(bool cancel)
+static Wave convert_wave(Wave wave)
 {
-    SetTraceLogLevel(LOG_INFO);
-    ffmpeg_end_rendering(ffmpeg_audio, cancel);
-    plug_reset();
-    paused = true;
-    ffmpeg_audio = NULL;
-}
+    for (size_t i = 0; i < converted_waves.count; ++i) {
+        Wave source = converted_waves.items[i].source;
+        if (
+            source.data       == wave.data       &&
+            source.frameCount == wave.frameCount &&
+            source.sampleRate == wave.sampleRate &&
+            source.sampleSize == wave.sampleSize &&
+            source.channels   == wave.channels
+        ) {
+            return converted_waves.items[i].wave;
+        }
+    }
 
-void dummy_play_sound(Sound _sound, Wave _wave)
-{
-    (void)_sound;
-    (void)_wave;
+    TraceLog(LOG_INFO,
+             "Converting sound with rate: %uhz, sample size: %u bits, channels: %u to rate: %dhz, sample size: %d bits, channels: %d",
+             wave.sampleRate, wave.sampleSize, wave.channels,
+             FFMPEG_SOUND_SAMPLE_RATE, FFMPEG_SOUND_SAMPLE_SIZE_BITS, FFMPEG_SOUND_CHANNELS);
+    Converted_Wave converted = {
+        .source = wave,
+        .wave = WaveCopy(wave),
+    };
+    WaveFormat(&converted.wave, FFMPEG_SOUND_SAMPLE_RATE, FFMPEG_SOUND_SAMPLE_SIZE_BITS, FFMPEG_SOUND_CHANNELS);
+    nob_da_append(&converted_waves, converted);
+    return converted.wave;
 }
 
 void ffmpeg_play_sound(Sound _sound, Wave wave)
 {
     (void)_sound;
 
+    if (wave.data == NULL || wave.frameCount == 0) return;
+
     if (
         wave.sampleRate != FFMPEG_SOUND_SAMPLE_RATE      ||
         wave.sampleSize != FFMPEG_SOUND_SAMPLE_SIZE_BITS ||
         wave.channels   != FFMPEG_SOUND_CHANNELS
     ) {
-        TraceLog(LOG_ERROR,
-                 "Animation tried to play sound with rate: %dhz, sample size: %d bits, channels: %d. "
-                 "But we only support rate: %dhz, sample size: %d bits, channels: %d for now",
-                 wave.sampleRate, wave.sampleSize, wave.channels);
-        return;
+        wave = convert_wave(wave);
     }
 
-    ffmpeg_wave = wave;
-    ffmpeg_wave_cursor = 0;
+    mixer_play(&ffmpeg_mixer, wave.data, wave.frameCount*wave.channels);
 }
 
 void preview_play_sound(Sound sound, Wave _wave)
@@ -120,6 +221,226 @@ void preview_play_sound(Sound sound, Wave _wave)
     PlaySound(sound);
 }
 
+// Forgets the snapshots taken after the given time
+static void drop_snapshots_after(Ticks time)
+{
+    while (snapshots.count > 0 && snapshots.items[snapshots.count - 1].time > time) {
+        free(snapshots.items[--snapshots.count].data);
+    }
+}
+
+// The snapshots are only valid for the same run of the animation with the same code
+static void clear_snapshots(void)
+{
+    drop_snapshots_after(-1);
+    snapshot_interval = SNAPSHOT_INTERVAL_SECS*TICKS_PER_SECOND;
+}
+
+#define PLUG_ARENAS_CAPACITY 16
+
+static void log_arena_stats(const char *when)
+{
+    if (plug_arenas == NULL) return;
+    Plug_Arena arenas[PLUG_ARENAS_CAPACITY];
+    size_t count = plug_arenas(arenas, PLUG_ARENAS_CAPACITY);
+    if (count > PLUG_ARENAS_CAPACITY) count = PLUG_ARENAS_CAPACITY;
+
+    TraceLog(LOG_INFO, "ARENA: usage %s", when);
+    TraceLog(LOG_INFO, "ARENA: %-12s %7s %10s %10s %10s %10s %10s %10s", "arena (KiB)",
+             "regions", "reserved", "requested", "allocated", "peak", "realloc", "skipped");
+    for (size_t i = 0; i < count; ++i) {
+        const Arena_Stats *s = &arenas[i].arena->stats;
+        TraceLog(LOG_INFO, "ARENA: %-12s %7zu %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f", arenas[i].name,
+                 s->regions, s->reserved/1024.0, s->requested/1024.0, s->allocated/1024.0,
+                 s->peak/1024.0, s->realloc_waste/1024.0, s->skipped/1024.0);
+    }
+}
+
+static void reset_animation(void)
+{
+    plug_reset();
+    log_arena_stats("after plug_reset()");
+    clear_snapshots();
+    preview_frames.count = 0;
+    clock_frame = 0;
+    clock_ticks = 0;
+}
+
+// Frame n of a render always starts at the same tick, no matter how the frames before it were
+// rendered (or skipped by a seek), even when the fps does not divide TICKS_PER_SECOND
+static Ticks render_frame_ticks(uint64_t frame)
+{
+    return (Ticks)frame*TICKS_PER_SECOND/render_config.fps;
+}
+
+// Env of the next rendered frame, advances the clock
+static Env render_env(void (*play_sound)(Sound sound, Wave wave))
+{
+    Ticks next = render_frame_ticks(clock_frame + 1);
+    Env env = {
+        .delta_time = (float)secs_from_ticks(next - clock_ticks),
+        .frame = clock_frame,
+        .time_ticks = clock_ticks,
+        .delta_ticks = next - clock_ticks,
+        .screen_width = render_config.width,
+        .screen_height = render_config.height,
+        .rendering = true,
+        .play_sound = play_sound,
+        .trace_begin = trace_enabled() ? trace_begin : NULL,
+        .trace_end = trace_enabled() ? trace_end : NULL,
+    };
+    clock_frame += 1;
+    clock_ticks = next;
+    return env;
+}
+
+// The mixer voices point into the converted waves, so they go away together
+static void release_ffmpeg_sound(void)
+{
+    mixer_clear(&ffmpeg_mixer);
+    clear_converted_waves();
+}
+
+static void reset_ffmpeg_sound(void)
+{
+    release_ffmpeg_sound();
+    ffmpeg_sound_frames = 0;
+
+    size_t capacity = (FFMPEG_SOUND_SAMPLE_RATE/render_config.fps + 1)*FFMPEG_SOUND_CHANNELS;
+    if (capacity > ffmpeg_sound_block_capacity) {
+        ffmpeg_sound_block = realloc(ffmpeg_sound_block, capacity*sizeof(*ffmpeg_sound_block));
+        assert(ffmpeg_sound_block != NULL && "Buy MORE RAM lol!!");
+        ffmpeg_sound_block_capacity = capacity;
+    }
+}
+
+static bool send_oldest_frame(void)
+{
+    trace_begin("readback");
+    void *pixels = readback_acquire(readback);
+    trace_end();
+    render_stats_mark(render_stats, RENDER_STAGE_READBACK);
+    if (pixels == NULL) return false;
+    trace_begin("send");
+    bool ok = ffmpeg_send_frame_flipped(ffmpeg_video, pixels, render_config.width, render_config.height);
+    readback_release(readback);
+    trace_end();
+    render_stats_mark(render_stats, RENDER_STAGE_SEND);
+    return ok;
+}
+
+// Sends one video frame worth of all the currently playing sounds mixed together
+static bool send_sound_frame(FFMPEG *ffmpeg)
+{
+    // When fps does not divide the sample rate the frames get either floor or ceil of
+    // the samples per frame, so the sound never drifts away from the video
+    size_t spf = (ffmpeg_sound_frames + 1)*FFMPEG_SOUND_SAMPLE_RATE/render_config.fps - ffmpeg_sound_frames*FFMPEG_SOUND_SAMPLE_RATE/render_config.fps;
+    ffmpeg_sound_frames += 1;
+
+    size_t count = spf*FFMPEG_SOUND_CHANNELS;
+    assert(count <= ffmpeg_sound_block_capacity);
+    mixer_mix(&ffmpeg_mixer, ffmpeg_sound_block, count);
+    return ffmpeg_send_sound_samples(ffmpeg, ffmpeg_sound_block, spf*FFMPEG_SOUND_FRAME_SIZE);
+}
+
+static bool start_ffmpeg_video_rendering(const char *output_path, bool sound, size_t first_frame)
+{
+    reset_ffmpeg_sound();
+    ffmpeg_video_sound = sound;
+    ffmpeg_video = ffmpeg_start_rendering_video(output_path, render_config.width, render_config.height, render_config.fps, FFMPEG_VIDEO_PIXEL_FORMAT, render_config.encoder, sound);
+    if (ffmpeg_video == NULL) return false;
+    readback = readback_create(render_config.width, render_config.height, READBACK_DEFAULT_RING_SIZE);
+    if (readback == NULL) {
+        ffmpeg_end_rendering(ffmpeg_video, true);
+        ffmpeg_video = NULL;
+        return false;
+    }
+    render_stats = render_stats_create(render_stats_csv_path, first_frame);
+    return true;
+}
+
+static bool render_video_frame(void)
+{
+    trace_begin("frame");
+    render_stats_begin_frame(render_stats);
+
+    trace_begin("plug_update");
+    if (task_update_count) *task_update_count = 0;
+    BeginTextureMode(screen);
+    plug_update(render_env(ffmpeg_play_sound));
+    trace_end();
+    if (task_update_count) render_stats_count_tasks(render_stats, *task_update_count);
+    render_stats_mark(render_stats, RENDER_STAGE_UPDATE);
+    trace_begin("gpu flush");
+    EndTextureMode();
+    trace_end();
+    render_stats_mark(render_stats, RENDER_STAGE_FLUSH);
+
+    bool ok = !ffmpeg_video_sound || send_sound_frame(ffmpeg_video);
+    render_stats_mark(render_stats, RENDER_STAGE_SOUND);
+    if (ok && readback_full(readback)) ok = send_oldest_frame();
+    if (ok) {
+        trace_begin("push");
+        ok = readback_push(readback, screen);
+        trace_end();
+        render_stats_mark(render_stats, RENDER_STAGE_PUSH);
+        render_stats_end_frame(render_stats);
+    }
+
+    trace_end();
+    return ok;
+}
+
+static bool end_ffmpeg_video_rendering(bool cancel)
+{
+    SetTraceLogLevel(LOG_INFO);
+    // The last few frames are still in flight in the readback ring
+    while (!cancel && readback_pending(readback) > 0) {
+        if (!send_oldest_frame()) cancel = true;
+    }
+    readback_destroy(readback);
+    readback = NULL;
+    bool ok = ffmpeg_end_rendering(ffmpeg_video, cancel);
+    ffmpeg_video = NULL;
+    release_ffmpeg_sound();
+    render_stats_report(render_stats);
+    log_arena_stats("at the end of the render");
+    render_stats_destroy(render_stats);
+    render_stats = NULL;
+    return ok && !cancel;
+}
+
+static void finish_ffmpeg_video_rendering(bool cancel)
+{
+    end_ffmpeg_video_rendering(cancel);
+    reset_animation();
+    paused = true;
+    SetTargetFPS(PREVIEW_FPS);
+}
+
+static void finish_ffmpeg_audio_rendering(bool cancel)
+{
+    SetTraceLogLevel(LOG_INFO);
+    log_arena_stats("at the end of the render");
+    ffmpeg_end_rendering(ffmpeg_audio, cancel);
+    release_ffmpeg_sound();
+    reset_animation();
+    paused = true;
+    ffmpeg_audio = NULL;
+    SetTargetFPS(PREVIEW_FPS);
+}
+
+static bool render_audio_frame(void)
+{
+    trace_begin("plug_update");
+    BeginTextureMode(screen);
+    plug_update(render_env(ffmpeg_play_sound));
+    EndTextureMode();
+    trace_end();
+
+    return send_sound_frame(ffmpeg_audio);
+}
+
 void rendering_scene(const char *text)
 {
     Color foreground_color = ColorFromHSV(0, 0, 0.95);
@@ -163,111 +484,577 @@ void rendering_scene(const char *text)
     }
 }
 
+static void mute_play_sound(Sound _sound, Wave _wave)
+{
+    (void)_sound;
+    (void)_wave;
+}
+
+static void take_snapshot_if_due(void)
+{
+    if (plug_snapshot == NULL || plug_restore == NULL) return;
+    if (snapshots.count > 0 && clock_ticks < snapshots.items[snapshots.count - 1].time + snapshot_interval) return;
+
+    if (snapshots.count >= SNAPSHOTS_CAPACITY) {
+        size_t count = 0;
+        for (size_t i = 0; i < snapshots.count; ++i) {
+            if (i%2 == 0) {
+                snapshots.items[count++] = snapshots.items[i];
+            } else {
+                free(snapshots.items[i].data);
+            }
+        }
+        snapshots.count = count;
+        snapshot_interval *= 2;
+    }
+
+    trace_begin("snapshot");
+    Snapshot snapshot = {
+        .frame = clock_frame,
+        .time = clock_ticks,
+        .data = plug_snapshot(),
+    };
+    nob_da_append(&snapshots, snapshot);
+    trace_end();
+}
+
+// Puts the animation into the state of the last frame shown at least secs seconds ago. Restores the
+// latest snapshot before that and replays the recorded frames from there muted and off screen.
+// Without snapshots replays from the start.
+static void jump_back(double secs)
+{
+    trace_begin("jump back");
+    Ticks target = clock_ticks - ticks_from_secs(secs);
+    if (target < 0) target = 0;
+
+    drop_snapshots_after(target);
+    if (snapshots.count > 0) {
+        Snapshot *snapshot = &snapshots.items[snapshots.count - 1];
+        plug_restore(snapshot->data);
+        clock_frame = snapshot->frame;
+        clock_ticks = snapshot->time;
+    } else {
+        // Unlike reset_animation() keeps the recorded frames
+        plug_reset();
+        clock_frame = 0;
+        clock_ticks = 0;
+    }
+
+    BeginTextureMode(screen);
+    while (clock_frame < preview_frames.count && clock_ticks + preview_frames.items[clock_frame].delta_ticks <= target) {
+        Preview_Frame frame = preview_frames.items[clock_frame];
+        plug_update(CLITERAL(Env) {
+            .delta_time = frame.delta_time,
+            .frame = clock_frame,
+            .time_ticks = clock_ticks,
+            .delta_ticks = frame.delta_ticks,
+            .screen_width = render_config.width,
+            .screen_height = render_config.height,
+            .rendering = false,
+            .play_sound = mute_play_sound,
+            .trace_begin = trace_enabled() ? trace_begin : NULL,
+            .trace_end = trace_enabled() ? trace_end : NULL,
+        });
+        clock_frame += 1;
+        clock_ticks += frame.delta_ticks;
+    }
+    EndTextureMode();
+    // The preview goes on from here with new frames
+    preview_frames.count = clock_frame;
+    trace_end();
+}
+
+// Puts the freshly reset animation into the state right before the given frame is rendered
+static void seek_frame(size_t frame)
+{
+    if (frame == 0) return;
+
+    trace_begin("seek");
+    if (plug_seek != NULL && use_plug_seek) {
+        plug_seek(render_frame_ticks(frame));
+        clock_frame = frame;
+        clock_ticks = render_frame_ticks(frame);
+        trace_end();
+        return;
+    }
+
+    // The plugin can't seek, so we replay everything up to the frame without sending it anywhere
+    for (size_t i = 0; i < frame && !plug_finished(); ++i) {
+        BeginTextureMode(screen);
+        plug_update(render_env(mute_play_sound));
+        EndTextureMode();
+    }
+    trace_end();
+}
+
+// The window is never shown, so headless rendering works on machines without a desktop (e.g. under Xvfb)
+static bool headless_init(const char *libplug_path)
+{
+    // raylib 5.0 crashes inside of InitWindow() if GLFW can't connect to anything, so we check it upfront
+    if (getenv("DISPLAY") == NULL && getenv("WAYLAND_DISPLAY") == NULL) {
+        fprintf(stderr, "ERROR: no display to create OpenGL context on. Try running under `xvfb-run -a`.\n");
+        return false;
+    }
+
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(render_config.width, render_config.height, "Panim");
+    if (!IsWindowReady()) {
+        fprintf(stderr, "ERROR: could not create OpenGL context for rendering %s\n", libplug_path);
+        return false;
+    }
+    InitAudioDevice();
+    plug_init();
+    log_arena_stats("after plug_init()");
+    screen = LoadRenderTexture(render_config.width, render_config.height);
+    return true;
+}
+
+static void headless_deinit(void)
+{
+    UnloadRenderTexture(screen);
+    CloseAudioDevice();
+    CloseWindow();
+}
+
+// Renders frames [frames_begin, frames_end) of the animation into output_path without any interaction and
+// on-screen feedback. The sound is only rendered when that's the whole animation, the segments of a parallel
+// render leave it to a separate worker. A segment that starts past the end of the animation produces no file.
+static int render_headless(const char *libplug_path, const char *output_path, size_t frames_begin, size_t frames_end)
+{
+    if (!headless_init(libplug_path)) return 1;
+
+    bool whole = frames_begin == 0 && frames_end == SIZE_MAX;
+    reset_animation();
+    SetTraceLogLevel(LOG_WARNING);
+    seek_frame(frames_begin);
+    if (!whole && plug_finished()) {
+        SetTraceLogLevel(LOG_INFO);
+        TraceLog(LOG_INFO, "Animation %s ends before frame %zu, nothing to render", libplug_path, frames_begin);
+        headless_deinit();
+        return 0;
+    }
+
+    bool ok = start_ffmpeg_video_rendering(output_path, whole, frames_begin);
+    if (ok) {
+        bool cancel = false;
+        for (size_t frame = frames_begin; !cancel && frame < frames_end && !plug_finished(); ++frame) {
+            if (!render_video_frame()) cancel = true;
+        }
+        ok = end_ffmpeg_video_rendering(cancel);
+    }
+    SetTraceLogLevel(LOG_INFO);
+
+    if (ok) {
+        TraceLog(LOG_INFO, "Rendered %s into %s", libplug_path, output_path);
+    } else {
+        TraceLog(LOG_ERROR, "Could not render %s into %s", libplug_path, output_path);
+    }
+
+    headless_deinit();
+    return ok ? 0 : 1;
+}
+
+// Renders only the sound of the whole animation into output_path
+static int render_headless_audio(const char *libplug_path, const char *output_path)
+{
+    if (!headless_init(libplug_path)) return 1;
+
+    reset_animation();
+    SetTraceLogLevel(LOG_WARNING);
+    reset_ffmpeg_sound();
+    ffmpeg_audio = ffmpeg_start_rendering_audio(output_path);
+    bool ok = ffmpeg_audio != NULL;
+    if (ok) {
+        bool cancel = false;
+        while (!cancel && !plug_finished()) {
+            if (!render_audio_frame()) cancel = true;
+        }
+        ok = ffmpeg_end_rendering(ffmpeg_audio, cancel) && !cancel;
+        ffmpeg_audio = NULL;
+        release_ffmpeg_sound();
+    }
+    SetTraceLogLevel(LOG_INFO);
+    log_arena_stats("at the end of the render");
+
+    if (ok) {
+        TraceLog(LOG_INFO, "Rendered sound of %s into %s", libplug_path, output_path);
+    } else {
+        TraceLog(LOG_ERROR, "Could not render sound of %s into %s", libplug_path, output_path);
+    }
+
+    headless_deinit();
+    return ok ? 0 : 1;
+}
+
+// The workers of a parallel render have to produce exactly the same kind of video
+static void append_render_config_args(Nob_Cmd *cmd)
+{
+    nob_cmd_append(cmd, "--size", nob_temp_sprintf("%zux%zu", render_config.width, render_config.height));
+    nob_cmd_append(cmd, "--fps", nob_temp_sprintf("%zu", render_config.fps));
+    nob_cmd_append(cmd, "--codec", render_config.encoder.codec);
+    if (render_config.encoder.preset != NULL) nob_cmd_append(cmd, "--preset", render_config.encoder.preset);
+    if (render_config.encoder.crf != NULL) nob_cmd_append(cmd, "--crf", render_config.encoder.crf);
+    if (render_config.encoder.bitrate != NULL) nob_cmd_append(cmd, "--bitrate", render_config.encoder.bitrate);
+    if (!use_plug_seek) nob_cmd_append(cmd, "--no-seek");
+}
+
+// Chunk of the worker that renders the sound of a parallel render
+#define AUDIO_CHUNK SIZE_MAX
+
+typedef struct {
+    Nob_Proc proc;
+    size_t chunk;
+} Render_Worker;
+
+// Splits the timeline into chunks of chunk_frames frames and renders them with up to jobs worker processes at
+// a time, each with its own OpenGL context, plugin instance and ffmpeg. The length of the animation is not
+// known upfront, so the chunks are handed out in order until a worker reports that its chunk starts past the
+// end. The sound is rendered by one more worker and muxed in when the segments are stitched together.
+// The workers write their --stats and --trace next to their segments, and those are joined into the
+// requested files at the end.
+static int render_parallel(const char *libplug_path, const char *output_path, size_t jobs, size_t chunk_frames, const char *trace_path)
+{
+    const char *segments_dir = nob_temp_sprintf("%s.segments", output_path);
+    if (!nob_mkdir_if_not_exists(segments_dir)) return 1;
+    const char *audio_path = nob_temp_sprintf("%s/audio.wav", segments_dir);
+    const char *audio_trace_path = nob_temp_sprintf("%s/audio.trace.json", segments_dir);
+
+    Nob_Cmd cmd = {0};
+    Nob_File_Paths segments = {0};
+    Render_Worker *workers = malloc(sizeof(*workers)*(jobs + 1));
+    assert(workers != NULL && "Buy MORE RAM lol!!");
+    size_t workers_count = 0;
+    bool audio_running = false;
+    size_t chunks_end = SIZE_MAX; // The first chunk that turned out to be past the end of the animation
+    bool ok = true;
+
+    nob_cmd_append(&cmd, "/proc/self/exe", "--render-audio", audio_path);
+    if (trace_path != NULL) nob_cmd_append(&cmd, "--trace", audio_trace_path);
+    append_render_config_args(&cmd);
+    nob_cmd_append(&cmd, libplug_path);
+    Nob_Proc audio_proc = nob_cmd_run_async(cmd);
+    if (audio_proc == NOB_INVALID_PROC) {
+        ok = false;
+    } else {
+        workers[workers_count++] = (Render_Worker) {audio_proc, AUDIO_CHUNK};
+        audio_running = true;
+    }
+
+    for (;;) {
+        while (ok && workers_count - audio_running < jobs && segments.count < chunks_end) {
+            size_t chunk = segments.count;
+            const char *segment_path = nob_temp_sprintf("%s/%08zu.mp4", segments_dir, chunk);
+            // The file not being there afterwards is how the worker tells that the chunk was empty
+            unlink(segment_path);
+            nob_da_append(&segments, segment_path);
+
+            size_t frames_begin = chunk*chunk_frames;
+            cmd.count = 0;
+            nob_cmd_append(&cmd, "/proc/self/exe", "--render", segment_path);
+            nob_cmd_append(&cmd, "--frames", nob_temp_sprintf("%zu:%zu", frames_begin, frames_begin + chunk_frames));
+            if (render_stats_csv_path != NULL) nob_cmd_append(&cmd, "--stats", nob_temp_sprintf("%s/%08zu.csv", segments_dir, chunk));
+            if (trace_path != NULL) nob_cmd_append(&cmd, "--trace", nob_temp_sprintf("%s/%08zu.trace.json", segments_dir, chunk));
+            append_render_config_args(&cmd);
+            nob_cmd_append(&cmd, libplug_path);
+            Nob_Proc proc = nob_cmd_run_async(cmd);
+            if (proc == NOB_INVALID_PROC) {
+                ok = false;
+                break;
+            }
+            workers[workers_count++] = (Render_Worker) {proc, chunk};
+        }
+        if (workers_count == 0) break;
+
+        int wstatus = 0;
+        pid_t pid = waitpid(-1, &wstatus, 0);
+        if (pid < 0) {
+            if (errno == EINTR) continue;
+            TraceLog(LOG_ERROR, "Could not wait for render workers: %s", strerror(errno));
+            ok = false;
+            break;
+        }
+
+        size_t i = 0;
+        while (i < workers_count && workers[i].proc != pid) ++i;
+        if (i >= workers_count) continue;
+        Render_Worker worker = workers[i];
+        workers[i] = workers[--workers_count];
+        if (worker.chunk == AUDIO_CHUNK) audio_running = false;
+
+        if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0) {
+            if (worker.chunk == AUDIO_CHUNK) {
+                TraceLog(LOG_ERROR, "Worker rendering the sound failed");
+            } else {
+                TraceLog(LOG_ERROR, "Worker rendering chunk %zu failed", worker.chunk);
+            }
+            if (ok) {
+                for (size_t j = 0; j < workers_count; ++j) kill(workers[j].proc, SIGTERM);
+            }
+            ok = false;
+        } else if (worker.chunk != AUDIO_CHUNK && worker.chunk < chunks_end && nob_file_exists(segments.items[worker.chunk]) == 0) {
+            chunks_end = worker.chunk;
+        }
+    }
+
+    if (ok && chunks_end == 0) {
+        TraceLog(LOG_ERROR, "Animation %s has no frames to render", libplug_path);
+        ok = false;
+    }
+    if (ok) ok = ffmpeg_concat_segments(output_path, segments.items, chunks_end, audio_path);
+
+    Nob_File_Paths stats = {0};
+    for (size_t i = 0; i < segments.count; ++i) nob_da_append(&stats, nob_temp_sprintf("%s/%08zu.csv", segments_dir, i));
+    if (ok && render_stats_csv_path != NULL) ok = render_stats_concat_csv(render_stats_csv_path, stats.items, chunks_end);
+
+    Nob_File_Paths traces = {0};
+    nob_da_append(&traces, audio_trace_path);
+    for (size_t i = 0; i < segments.count; ++i) nob_da_append(&traces, nob_temp_sprintf("%s/%08zu.trace.json", segments_dir, i));
+    if (trace_path != NULL) {
+        // Also the ones of the failed workers, they show what went wrong
+        for (size_t i = 0; i < traces.count; ++i) {
+            if (nob_file_exists(traces.items[i]) == 1) trace_merge(traces.items[i]);
+        }
+    }
+
+    if (ok) {
+        TraceLog(LOG_INFO, "Rendered %s into %s in %zu chunks by %zu workers", libplug_path, output_path, chunks_end, jobs);
+    } else {
+        TraceLog(LOG_ERROR, "Could not render %s into %s", libplug_path, output_path);
+    }
+
+    for (size_t i = 0; i < segments.count; ++i) unlink(segments.items[i]);
+    for (size_t i = 0; i < stats.count; ++i) unlink(stats.items[i]);
+    for (size_t i = 0; i < traces.count; ++i) unlink(traces.items[i]);
+    unlink(audio_path);
+    rmdir(segments_dir);
+    free(workers);
+    nob_da_free(segments);
+    nob_da_free(stats);
+    nob_da_free(traces);
+    nob_cmd_free(cmd);
+    return ok ? 0 : 1;
+}
+
+static bool parse_size(const char *text, size_t *result)
+{
+    char *end = NULL;
+    errno = 0;
+    unsigned long long value = strtoull(text, &end, 10);
+    if (errno != 0 || end == text || *end != '\0' || *text == '-') return false;
+    *result = value;
+    return true;
+}
+
+// Parses "<a><separator><b>" like 1920x1080 or 0:300
+static bool parse_size_pair(const char *text, char separator, size_t *a, size_t *b)
+{
+    const char *sep = strchr(text, separator);
+    return sep != NULL &&
+           parse_size(nob_temp_sprintf("%.*s", (int)(sep - text), text), a) &&
+           parse_size(sep + 1, b);
+}
+
+static void usage(const char *program_name)
+{
+    fprintf(stderr, "Usage: %s [OPTIONS] <libplug.so>\n", program_name);
+    fprintf(stderr, "OPTIONS:\n");
+    fprintf(stderr, "    --render <output.mp4>          render the animation into the file without opening the window and exit\n");
+    fprintf(stderr, "    --jobs <n>                     render in parallel by n worker processes (default: 1)\n");
+    fprintf(stderr, "    --chunk <frames>               amount of frames a worker renders at a time with --jobs (default: %d seconds worth)\n", PARALLEL_CHUNK_SECS);
+    fprintf(stderr, "    --no-seek                      replay the animation up to the chunk of every worker instead of calling plug_seek()\n");
+    fprintf(stderr, "    --size <width>x<height>        resolution of the rendered video (default: %dx%d)\n", FFMPEG_VIDEO_WIDTH, FFMPEG_VIDEO_HEIGHT);
+    fprintf(stderr, "    --fps <n>                      frame rate of the rendered video (default: %d)\n", FFMPEG_VIDEO_FPS);
+    fprintf(stderr, "    --codec <name>                 ffmpeg video encoder (default: %s)\n", FFMPEG_DEFAULT_ENCODER.codec);
+    fprintf(stderr, "    --preset <name>                encoder preset, e.g. ultrafast or veryslow for libx264\n");
+    fprintf(stderr, "    --crf <n>                      constant quality, takes precedence over --bitrate\n");
+    fprintf(stderr, "    --bitrate <rate>               target video bitrate (default: %s)\n", FFMPEG_DEFAULT_ENCODER.bitrate);
+    fprintf(stderr, "    --draft                        quick preview render: %dx%d, %s preset\n", DRAFT_WIDTH, DRAFT_HEIGHT, DRAFT_PRESET);
+    fprintf(stderr, "    --stats <frames.csv>           save how long every stage of every rendered frame took (the summary is always logged)\n");
+    fprintf(stderr, "    --trace <trace.json>           record what the engine and the tasks are doing for Perfetto or chrome://tracing\n");
+    fprintf(stderr, "    --frames <begin>:<end>         render only frames [begin, end) without the sound (used by the workers)\n");
+    fprintf(stderr, "    --render-audio <output.wav>    render only the sound of the animation and exit (used by the workers)\n");
+}
+
+static const char *options_with_value[] = {
+    "--render", "--render-audio", "--jobs", "--chunk", "--frames", "--stats", "--trace",
+    "--size", "--fps", "--codec", "--preset", "--crf", "--bitrate",
+};
+
+static bool is_option_with_value(const char *arg)
+{
+    for (size_t i = 0; i < NOB_ARRAY_LEN(options_with_value); ++i) {
+        if (strcmp(arg, options_with_value[i]) == 0) return true;
+    }
+    return false;
+}
+
 int main(int argc, char **argv)
 {
     const char *program_name = nob_shift_args(&argc, &argv);
 
-    if (argc <= 0) {
-        fprintf(stderr, "Usage: %s <libplug.so>\n", program_name);
+    const char *libplug_path = NULL;
+    const char *render_output_path = NULL;
+    const char *render_audio_path = NULL;
+    const char *trace_path = NULL;
+    size_t jobs = 1;
+    size_t chunk_frames = 0;
+    size_t frames_begin = 0;
+    size_t frames_end = SIZE_MAX;
+    while (argc > 0) {
+        const char *arg = nob_shift_args(&argc, &argv);
+        if (strcmp(arg, "--draft") == 0) {
+            render_config.width = DRAFT_WIDTH;
+            render_config.height = DRAFT_HEIGHT;
+            render_config.encoder.preset = DRAFT_PRESET;
+        } else if (strcmp(arg, "--no-seek") == 0) {
+            use_plug_seek = false;
+        } else if (is_option_with_value(arg)) {
+            if (argc <= 0) {
+                usage(program_name);
+                fprintf(stderr, "ERROR: no value is provided for %s\n", arg);
+                return 1;
+            }
+            const char *value = nob_shift_args(&argc, &argv);
+            bool valid = true;
+            if (strcmp(arg, "--render") == 0) {
+                render_output_path = value;
+            } else if (strcmp(arg, "--render-audio") == 0) {
+                render_audio_path = value;
+            } else if (strcmp(arg, "--stats") == 0) {
+                render_stats_csv_path = value;
+            } else if (strcmp(arg, "--trace") == 0) {
+                trace_path = value;
+            } else if (strcmp(arg, "--jobs") == 0) {
+                valid = parse_size(value, &jobs) && jobs > 0;
+            } else if (strcmp(arg, "--chunk") == 0) {
+                valid = parse_size(value, &chunk_frames) && chunk_frames > 0;
+            } else if (strcmp(arg, "--frames") == 0) {
+                valid = parse_size_pair(value, ':', &frames_begin, &frames_end) && frames_begin < frames_end;
+            } else if (strcmp(arg, "--size") == 0) {
+                valid = parse_size_pair(value, 'x', &render_config.width, &render_config.height) &&
+                        render_config.width > 0 && render_config.height > 0;
+            } else if (strcmp(arg, "--fps") == 0) {
+                valid = parse_size(value, &render_config.fps) && render_config.fps > 0;
+            } else if (strcmp(arg, "--codec") == 0) {
+                render_config.encoder.codec = value;
+            } else if (strcmp(arg, "--preset") == 0) {
+                render_config.encoder.preset = value;
+            } else if (strcmp(arg, "--crf") == 0) {
+                render_config.encoder.crf = value;
+            } else if (strcmp(arg, "--bitrate") == 0) {
+                render_config.encoder.bitrate = value;
+            } else {
+                assert(0 && "unreachable");
+            }
+            if (!valid) {
+                usage(program_name);
+                fprintf(stderr, "ERROR: invalid value %s for %s\n", value, arg);
+                return 1;
+            }
+        } else if (libplug_path == NULL) {
+            libplug_path = arg;
+        } else {
+            usage(program_name);
+            fprintf(stderr, "ERROR: unexpected argument %s\n", arg);
+            return 1;
+        }
+    }
+    if (chunk_frames == 0) chunk_frames = PARALLEL_CHUNK_SECS*render_config.fps;
+
+    if (libplug_path == NULL) {
+        usage(program_name);
         fprintf(stderr, "ERROR: no animation dynamic library is provided\n");
         return 1;
     }
 
-    const char *libplug_path = nob_shift_args(&argc, &argv);
-
     if (!reload_libplug(libplug_path)) return 1;
 
+    if (trace_path != NULL) {
+        if (!trace_start(trace_path)) return 1;
+        atexit(trace_stop);
+    }
+
+    if (render_audio_path != NULL) return render_headless_audio(libplug_path, render_audio_path);
+    if (render_output_path != NULL) {
+        if (jobs > 1) return render_parallel(libplug_path, render_output_path, jobs, chunk_frames, trace_path);
+        return render_headless(libplug_path, render_output_path, frames_begin, frames_end);
+    }
+
     float factor = 100.0f;
     SetConfigFlags(FLAG_MSAA_4X_HINT | FLAG_WINDOW_RESIZABLE);
     InitWindow(16*factor, 9*factor, "Panim");
     InitAudioDevice();
-    SetTargetFPS(60);
+    SetTargetFPS(PREVIEW_FPS);
     SetExitKey(KEY_NULL);
     plug_init();
+    log_arena_stats("after plug_init()");
 
-    screen = LoadRenderTexture(FFMPEG_VIDEO_WIDTH, FFMPEG_VIDEO_HEIGHT);
+    screen = LoadRenderTexture(render_config.width, render_config.height);
     rendering_font = LoadFontEx("./assets/fonts/Vollkorn-Regular.ttf", RENDERING_FONT_SIZE, NULL, 0);
 
     while (!WindowShouldClose()) {
+        trace_begin("window frame");
         BeginDrawing();
             if (ffmpeg_video) {
-                if (plug_finished()) {
-                    finish_ffmpeg_video_rendering(false);
-                } else if (IsKeyPressed(KEY_ESCAPE)) {
+                if (IsKeyPressed(KEY_ESCAPE)) {
                     finish_ffmpeg_video_rendering(true);
                 } else {
-                    BeginTextureMode(screen);
-                    plug_update(CLITERAL(Env) {
-                        .screen_width = FFMPEG_VIDEO_WIDTH,
-                        .screen_height = FFMPEG_VIDEO_HEIGHT,
-                        .delta_time = FFMPEG_VIDEO_DELTA_TIME,
-                        .rendering = true,
-                        .play_sound = dummy_play_sound,
-                    });
-                    EndTextureMode();
-
-                    Image image = LoadImageFromTexture(screen.texture);
-                    if (!ffmpeg_send_frame_flipped(ffmpeg_video, image.data, image.width, image.height)) {
-                        finish_ffmpeg_video_rendering(true);
+                    double deadline = GetTime() + RENDERING_UI_REFRESH_INTERVAL;
+                    while (ffmpeg_video && GetTime() < deadline) {
+                        if (plug_finished()) {
+                            finish_ffmpeg_video_rendering(false);
+                        } else if (!render_video_frame()) {
+                            finish_ffmpeg_video_rendering(true);
+                        }
                     }
-                    UnloadImage(image);
                 }
                 rendering_scene("Rendering Video");
             } else if (ffmpeg_audio) {
-                if (plug_finished()) {
-                    finish_ffmpeg_audio_rendering(false);
-                } else if (IsKeyPressed(KEY_ESCAPE)) {
+                if (IsKeyPressed(KEY_ESCAPE)) {
                     finish_ffmpeg_audio_rendering(true);
                 } else {
-                    BeginTextureMode(screen);
-                    plug_update(CLITERAL(Env) {
-                        .screen_width = FFMPEG_VIDEO_WIDTH,
-                        .screen_height = FFMPEG_VIDEO_HEIGHT,
-                        .delta_time = FFMPEG_VIDEO_DELTA_TIME,
-                        .rendering = true,
-                        .play_sound = ffmpeg_play_sound,
-                    });
-                    EndTextureMode();
-
-                    size_t frame_count = ffmpeg_wave.frameCount;
-                    size_t frame_size = FFMPEG_SOUND_SAMPLE_SIZE_BYTES*FFMPEG_SOUND_CHANNELS;
-                    size_t frames_begin = ffmpeg_wave_cursor;
-                    size_t frames_end = ffmpeg_wave_cursor + FFMPEG_SOUND_SPF;
-                    if (frames_end > frame_count) {
-                        frames_end = frame_count;
-                    }
-                    void *sound_data = (uint8_t*)ffmpeg_wave.data + frames_begin*frame_size;
-                    size_t sound_size = (frames_end - frames_begin)*frame_size;
-                    if (!ffmpeg_send_sound_samples(ffmpeg_audio, sound_data, sound_size)) {
-                        finish_ffmpeg_audio_rendering(true);
-                    }
-                    ffmpeg_wave_cursor += frames_end - frames_begin;
-                    size_t silence_size = (FFMPEG_SOUND_SPF - (frames_end - frames_begin))*frame_size;
-                    if (!ffmpeg_send_sound_samples(ffmpeg_audio, silence, silence_size)) {
-                        finish_ffmpeg_audio_rendering(true);
+                    double deadline = GetTime() + RENDERING_UI_REFRESH_INTERVAL;
+                    while (ffmpeg_audio && GetTime() < deadline) {
+                        if (plug_finished()) {
+                            finish_ffmpeg_audio_rendering(false);
+                        } else if (!render_audio_frame()) {
+                            finish_ffmpeg_audio_rendering(true);
+                        }
                     }
                 }
                 rendering_scene("Rendering Audio");
             } else {
                 if (IsKeyPressed(KEY_R)) {
+                    // Reset before muting the log, so the arena stats of the fresh animation are still shown
+                    reset_animation();
                     SetTraceLogLevel(LOG_WARNING);
-                    ffmpeg_video = ffmpeg_start_rendering_video("output.mp4", FFMPEG_VIDEO_WIDTH, FFMPEG_VIDEO_HEIGHT, FFMPEG_VIDEO_FPS);
-                    plug_reset();
+                    if (start_ffmpeg_video_rendering("output.mp4", true, 0)) {
+                        // Rendering is not paced, the window is only refreshed every RENDERING_UI_REFRESH_INTERVAL
+                        SetTargetFPS(0);
+                    }
                 } else if (IsKeyPressed(KEY_T)) {
+                    reset_animation();
                     SetTraceLogLevel(LOG_WARNING);
+                    reset_ffmpeg_sound();
                     ffmpeg_audio = ffmpeg_start_rendering_audio("output.wav");
-                    plug_reset();
+                    if (ffmpeg_audio) SetTargetFPS(0);
                 } else {
                     if (IsKeyPressed(KEY_H)) {
+                        trace_begin("hot reload");
                         void *state = plug_pre_reload();
                         reload_libplug(libplug_path);
                         plug_post_reload(state);
+                        clear_snapshots();
+                        trace_end();
                     }
                     if (IsKeyPressed(KEY_SPACE)) {
                         paused = !paused;
                     }
                     if (IsKeyPressed(KEY_Q)) {
-                        plug_reset();
+                        reset_animation();
+                    }
+                    if (IsKeyPressed(KEY_LEFT)) {
+                        jump_back(JUMP_BACK_SECS);
                     }
                     if (IsKeyPressed(KEY_PERIOD)) {
                         delta_time_multiplier += 0.1;
@@ -282,13 +1069,28 @@ int main(int argc, char **argv)
                         delta_time_multiplier_popup = 1.0f;
                     }
 
+                    take_snapshot_if_due();
+
+                    trace_begin("plug_update");
+                    float delta_time = paused ? 0.0 : GetFrameTime()*delta_time_multiplier;
+                    Ticks delta_ticks = ticks_from_secs(delta_time);
                     plug_update(CLITERAL(Env) {
+                        .delta_time = delta_time,
+                        .frame = clock_frame,
+                        .time_ticks = clock_ticks,
+                        .delta_ticks = delta_ticks,
                         .screen_width = GetScreenWidth(),
                         .screen_height = GetScreenHeight(),
-                        .delta_time = paused ? 0.0 : GetFrameTime()*delta_time_multiplier,
                         .rendering = false,
                         .play_sound = preview_play_sound,
+                        .trace_begin = trace_enabled() ? trace_begin : NULL,
+                        .trace_end = trace_enabled() ? trace_end : NULL,
                     });
+                    assert(preview_frames.count == clock_frame);
+                    nob_da_append(&preview_frames, ((Preview_Frame) {delta_time, delta_ticks}));
+                    clock_frame += 1;
+                    clock_ticks += delta_ticks;
+                    trace_end();
 
                     const char *text = TextFormat("Delta Time Multiplier: %.2fx", delta_time_multiplier);
                     Vector2 text_size = MeasureTextEx(rendering_font, text, RENDERING_FONT_SIZE, 0);
@@ -304,6 +1106,7 @@ int main(int argc, char **argv)
                 }
             }
         EndDrawing();
+        trace_end();
     }
 
     CloseWindow();
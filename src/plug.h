@@ -1,7 +1,15 @@
 #ifndef PLUG_H_
 #define PLUG_H_
 
+#include <stddef.h>
+
 #include "env.h"
+#include "arena.h"
+
+typedef struct {
+    const char *name;
+    const Arena *arena;
+} Plug_Arena;
 
 // void plug_init(void)
 // void *plug_pre_reload(void)
@@ -18,4 +26,16 @@
     PLUG(plug_reset, void, void)        /* Reset the state of the animation */ \
     PLUG(plug_finished, bool, void)     /* Check if the animation is finished */ \
 
+// The plugin may leave these out, panim falls back to something slower
+// void plug_seek(Ticks t)
+// void *plug_snapshot(void)
+// void plug_restore(void *snapshot)
+// size_t plug_arenas(Plug_Arena *arenas, size_t capacity)
+
+#define LIST_OF_OPTIONAL_PLUGS \
+    PLUG(plug_seek, void, Ticks)        /* Put the animation into the state it has t ticks after plug_reset() */ \
+    PLUG(plug_snapshot, void*, void)    /* Copy of the whole state of the animation in a single malloc()-ed block, panim free()-s it */ \
+    PLUG(plug_restore, void, void*)     /* Put the animation back into the state of a snapshot taken since the last reload */ \
+    PLUG(plug_arenas, size_t, Plug_Arena*, size_t) /* Fill up to capacity arenas of the plugin so panim can report their usage, return how many there are */ \
+
 #endif // PLUG_H_
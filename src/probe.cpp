@@ -51,23 +51,23 @@ protected:
 
 class Wait: public Task {
 public:
-    Wait(float duration):
+    Wait(double duration):
         started(false),
-        cursor(0.0f),
-        duration(duration)
+        cursor(0),
+        duration(ticks_from_secs(duration))
     {}
 
     bool done() const
     {
-        return cursor > duration;
+        return cursor >= duration;
     }
 
     float interp() const
     {
-        if (duration <= 0.0f) {
+        if (duration <= 0) {
             return 0.0f;
         } else {
-            return cursor/duration;
+            return (float)((double)cursor/duration);
         }
     }
 
@@ -75,19 +75,20 @@ public:
     {
         if (done()) return true;
         if (!started) started = true;
-        cursor += env.delta_time;
+        cursor += env.delta_ticks;
+        if (cursor > duration) cursor = duration;
         return done();
     }
 
 protected:
     bool started;
-    float cursor;
-    float duration;
+    Ticks cursor;
+    Ticks duration;
 };
 
 class Move_Vec2: public Wait {
 public:
-    Move_Vec2(Vector2 *place, Vector2 target, float duration):
+    Move_Vec2(Vector2 *place, Vector2 target, double duration):
         Wait(duration),
         place(place),
         start(Vector2()),
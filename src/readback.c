@@ -0,0 +1,164 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <raylib.h>
+#include <rlgl.h>
+
+#include "readback.h"
+
+// raylib does not expose pixel pack buffers, so we load the few GL entry points we
+// need ourselves through GLFW which is linked into libraylib.so anyway.
+typedef void (*GLFWglproc)(void);
+GLFWglproc glfwGetProcAddress(const char *procname);
+
+typedef unsigned int GLenum;
+typedef unsigned int GLuint;
+typedef int GLint;
+typedef int GLsizei;
+typedef unsigned int GLbitfield;
+typedef unsigned char GLboolean;
+typedef ptrdiff_t GLintptr;
+typedef ptrdiff_t GLsizeiptr;
+
+#define GL_PIXEL_PACK_BUFFER 0x88EB
+#define GL_STREAM_READ       0x88E1
+#define GL_MAP_READ_BIT      0x0001
+#define GL_RGBA              0x1908
+#define GL_UNSIGNED_BYTE     0x1401
+#define GL_PACK_ALIGNMENT    0x0D05
+
+#define LIST_OF_GL_PROCS \
+    GL_PROC(glGenBuffers, void, GLsizei, GLuint*) \
+    GL_PROC(glDeleteBuffers, void, GLsizei, const GLuint*) \
+    GL_PROC(glBindBuffer, void, GLenum, GLuint) \
+    GL_PROC(glBufferData, void, GLenum, GLsizeiptr, const void*, GLenum) \
+    GL_PROC(glMapBufferRange, void*, GLenum, GLintptr, GLsizeiptr, GLbitfield) \
+    GL_PROC(glUnmapBuffer, GLboolean, GLenum) \
+    GL_PROC(glPixelStorei, void, GLenum, GLint) \
+    GL_PROC(glReadPixels, void, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void*) \
+
+#define GL_PROC(name, ret, ...) static ret (*name)(__VA_ARGS__) = NULL;
+LIST_OF_GL_PROCS
+#undef GL_PROC
+
+static bool load_gl_procs(void)
+{
+    #define GL_PROC(name, ...) \
+        if (name == NULL) { \
+            name = (void*)glfwGetProcAddress(#name); \
+            if (name == NULL) { \
+                TraceLog(LOG_ERROR, "READBACK: could not load %s", #name); \
+                return false; \
+            } \
+        }
+    LIST_OF_GL_PROCS
+    #undef GL_PROC
+    return true;
+}
+
+struct Readback {
+    size_t width;
+    size_t height;
+    GLuint *pbos;
+    size_t ring_size;
+    size_t begin;   // index of the oldest pending buffer
+    size_t count;   // amount of pending buffers
+    bool acquired;
+};
+
+Readback *readback_create(size_t width, size_t height, size_t ring_size)
+{
+    assert(ring_size > 0);
+    if (!load_gl_procs()) return NULL;
+
+    Readback *rb = malloc(sizeof(Readback));
+    assert(rb != NULL && "Buy MORE RAM lol!!");
+    rb->width = width;
+    rb->height = height;
+    rb->ring_size = ring_size;
+    rb->begin = 0;
+    rb->count = 0;
+    rb->acquired = false;
+    rb->pbos = malloc(sizeof(*rb->pbos)*ring_size);
+    assert(rb->pbos != NULL && "Buy MORE RAM lol!!");
+
+    glGenBuffers(ring_size, rb->pbos);
+    for (size_t i = 0; i < ring_size; ++i) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbos[i]);
+        glBufferData(GL_PIXEL_PACK_BUFFER, width*height*sizeof(uint32_t), NULL, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    return rb;
+}
+
+void readback_destroy(Readback *rb)
+{
+    if (rb->acquired) readback_release(rb);
+    glDeleteBuffers(rb->ring_size, rb->pbos);
+    free(rb->pbos);
+    free(rb);
+}
+
+size_t readback_pending(Readback *rb)
+{
+    return rb->count;
+}
+
+bool readback_full(Readback *rb)
+{
+    return rb->count >= rb->ring_size;
+}
+
+bool readback_push(Readback *rb, RenderTexture2D target)
+{
+    if (readback_full(rb)) {
+        TraceLog(LOG_ERROR, "READBACK: all %zu pixel pack buffers are busy", rb->ring_size);
+        return false;
+    }
+    assert((size_t)target.texture.width == rb->width);
+    assert((size_t)target.texture.height == rb->height);
+
+    // Whatever is still batched by rlgl has to reach the framebuffer before we read it.
+    rlDrawRenderBatchActive();
+
+    GLuint pbo = rb->pbos[(rb->begin + rb->count)%rb->ring_size];
+    rlEnableFramebuffer(target.id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    // With a pack buffer bound the last argument is an offset into it and the call returns immediately
+    glReadPixels(0, 0, rb->width, rb->height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    rlDisableFramebuffer();
+
+    rb->count += 1;
+    return true;
+}
+
+void *readback_acquire(Readback *rb)
+{
+    assert(!rb->acquired);
+    if (rb->count == 0) return NULL;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbos[rb->begin]);
+    void *data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, rb->width*rb->height*sizeof(uint32_t), GL_MAP_READ_BIT);
+    if (data == NULL) {
+        TraceLog(LOG_ERROR, "READBACK: could not map pixel pack buffer");
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        return NULL;
+    }
+    rb->acquired = true;
+    return data;
+}
+
+void readback_release(Readback *rb)
+{
+    assert(rb->acquired);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, rb->pbos[rb->begin]);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    rb->acquired = false;
+    rb->begin = (rb->begin + 1)%rb->ring_size;
+    rb->count -= 1;
+}
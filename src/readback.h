@@ -0,0 +1,25 @@
+#ifndef READBACK_H_
+#define READBACK_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <raylib.h>
+
+// Asynchronous readback of RenderTexture2D-s through a ring of pixel pack buffers.
+// readback_push() only schedules the transfer, so the GPU can copy frame N while
+// we are already drawing frame N+1. The pixels of the oldest scheduled frame are
+// accessible between readback_acquire() and readback_release(). Like
+// LoadImageFromTexture() the rows come out bottom-to-top in RGBA8.
+typedef struct Readback Readback;
+
+#define READBACK_DEFAULT_RING_SIZE 3
+
+Readback *readback_create(size_t width, size_t height, size_t ring_size);
+void readback_destroy(Readback *rb);
+size_t readback_pending(Readback *rb);
+bool readback_full(Readback *rb);
+bool readback_push(Readback *rb, RenderTexture2D target);
+void *readback_acquire(Readback *rb);
+void readback_release(Readback *rb);
+
+#endif // READBACK_H_
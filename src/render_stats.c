@@ -0,0 +1,220 @@
+#include <assert.h>
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <sys/resource.h>
+
+#include <raylib.h>
+
+#include "render_stats.h"
+
+static const char *stage_names[COUNT_RENDER_STAGES] = {
+    [RENDER_STAGE_UPDATE]   = "plug_update",
+    [RENDER_STAGE_FLUSH]    = "gpu_flush",
+    [RENDER_STAGE_SOUND]    = "sound",
+    [RENDER_STAGE_READBACK] = "readback",
+    [RENDER_STAGE_SEND]     = "send",
+    [RENDER_STAGE_PUSH]     = "push",
+};
+
+typedef struct {
+    double stages[COUNT_RENDER_STAGES];
+    double total;
+    size_t tasks;
+} Frame_Timings;
+
+struct Render_Stats {
+    FILE *csv;
+    size_t first_frame;
+    double start;
+    double last;
+    bool in_frame;
+    bool tasks_counted;
+    Frame_Timings current;
+
+    Frame_Timings *items;
+    size_t count;
+    size_t capacity;
+};
+
+static double now_secs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+Render_Stats *render_stats_create(const char *csv_path, size_t first_frame)
+{
+    Render_Stats *rs = malloc(sizeof(Render_Stats));
+    assert(rs != NULL && "Buy MORE RAM lol!!");
+    memset(rs, 0, sizeof(*rs));
+    rs->first_frame = first_frame;
+
+    if (csv_path != NULL) {
+        rs->csv = fopen(csv_path, "w");
+        if (rs->csv == NULL) {
+            TraceLog(LOG_ERROR, "RENDER: could not open %s: %s", csv_path, strerror(errno));
+        } else {
+            fprintf(rs->csv, "frame");
+            for (size_t i = 0; i < COUNT_RENDER_STAGES; ++i) fprintf(rs->csv, ",%s", stage_names[i]);
+            fprintf(rs->csv, ",total,tasks\n");
+        }
+    }
+
+    rs->start = now_secs();
+    return rs;
+}
+
+void render_stats_destroy(Render_Stats *rs)
+{
+    if (rs->csv != NULL) fclose(rs->csv);
+    free(rs->items);
+    free(rs);
+}
+
+void render_stats_begin_frame(Render_Stats *rs)
+{
+    memset(&rs->current, 0, sizeof(rs->current));
+    rs->in_frame = true;
+    rs->last = now_secs();
+}
+
+void render_stats_mark(Render_Stats *rs, Render_Stage stage)
+{
+    if (!rs->in_frame) return;
+    double now = now_secs();
+    rs->current.stages[stage] += now - rs->last;
+    rs->current.total += now - rs->last;
+    rs->last = now;
+}
+
+void render_stats_count_tasks(Render_Stats *rs, size_t count)
+{
+    if (!rs->in_frame) return;
+    rs->current.tasks = count;
+    rs->tasks_counted = true;
+}
+
+void render_stats_end_frame(Render_Stats *rs)
+{
+    if (!rs->in_frame) return;
+    rs->in_frame = false;
+
+    if (rs->count >= rs->capacity) {
+        rs->capacity = rs->capacity == 0 ? 1024 : rs->capacity*2;
+        rs->items = realloc(rs->items, sizeof(*rs->items)*rs->capacity);
+        assert(rs->items != NULL && "Buy MORE RAM lol!!");
+    }
+    rs->items[rs->count++] = rs->current;
+
+    if (rs->csv != NULL) {
+        fprintf(rs->csv, "%zu", rs->first_frame + rs->count - 1);
+        for (size_t i = 0; i < COUNT_RENDER_STAGES; ++i) fprintf(rs->csv, ",%.3f", rs->current.stages[i]*1000);
+        fprintf(rs->csv, ",%.3f,%zu\n", rs->current.total*1000, rs->current.tasks);
+    }
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of already sorted samples
+static double percentile(const double *sorted, size_t count, double p)
+{
+    size_t rank = (size_t)ceil(p*count);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1];
+}
+
+static void report_column(const char *name, const double *sorted, size_t count)
+{
+    double sum = 0;
+    for (size_t i = 0; i < count; ++i) sum += sorted[i];
+    TraceLog(LOG_INFO, "RENDER: %-12s %9.3f %9.3f %9.3f %9.3f", name,
+             sum/count*1000,
+             percentile(sorted, count, 0.50)*1000,
+             percentile(sorted, count, 0.99)*1000,
+             sorted[count - 1]*1000);
+}
+
+void render_stats_report(Render_Stats *rs)
+{
+    double elapsed = now_secs() - rs->start;
+    TraceLog(LOG_INFO, "RENDER: %zu frames in %.3fs, %.2f fps", rs->count, elapsed, elapsed > 0 ? rs->count/elapsed : 0.0);
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        TraceLog(LOG_INFO, "RENDER: peak RSS %.1f MiB", usage.ru_maxrss/1024.0);
+    }
+    if (rs->count == 0) return;
+
+    double *column = malloc(sizeof(*column)*rs->count);
+    assert(column != NULL && "Buy MORE RAM lol!!");
+
+    TraceLog(LOG_INFO, "RENDER: %-12s %9s %9s %9s %9s", "stage (ms)", "mean", "p50", "p99", "max");
+    for (size_t stage = 0; stage <= COUNT_RENDER_STAGES; ++stage) {
+        for (size_t i = 0; i < rs->count; ++i) {
+            column[i] = stage < COUNT_RENDER_STAGES ? rs->items[i].stages[stage] : rs->items[i].total;
+        }
+        qsort(column, rs->count, sizeof(*column), compare_doubles);
+        report_column(stage < COUNT_RENDER_STAGES ? stage_names[stage] : "total", column, rs->count);
+    }
+
+    free(column);
+
+    if (rs->tasks_counted) {
+        size_t sum = 0;
+        size_t max = 0;
+        for (size_t i = 0; i < rs->count; ++i) {
+            sum += rs->items[i].tasks;
+            if (rs->items[i].tasks > max) max = rs->items[i].tasks;
+        }
+        TraceLog(LOG_INFO, "RENDER: tasks updated per frame: mean %.1f, max %zu", (double)sum/rs->count, max);
+    }
+}
+
+bool render_stats_concat_csv(const char *output_path, const char **csv_paths, size_t csv_paths_count)
+{
+    FILE *out = fopen(output_path, "w");
+    if (out == NULL) {
+        TraceLog(LOG_ERROR, "RENDER: could not open %s: %s", output_path, strerror(errno));
+        return false;
+    }
+
+    bool ok = true;
+    char buffer[4096];
+    for (size_t i = 0; ok && i < csv_paths_count; ++i) {
+        FILE *in = fopen(csv_paths[i], "r");
+        if (in == NULL) {
+            TraceLog(LOG_ERROR, "RENDER: could not open %s: %s", csv_paths[i], strerror(errno));
+            ok = false;
+            break;
+        }
+        // Only the first file keeps its header
+        bool skipping_header = i > 0;
+        while (fgets(buffer, sizeof(buffer), in) != NULL) {
+            if (!skipping_header) fputs(buffer, out);
+            if (buffer[strlen(buffer) - 1] == '\n') skipping_header = false;
+        }
+        if (ferror(in)) {
+            TraceLog(LOG_ERROR, "RENDER: could not read %s: %s", csv_paths[i], strerror(errno));
+            ok = false;
+        }
+        fclose(in);
+    }
+
+    if (fclose(out) != 0 && ok) {
+        TraceLog(LOG_ERROR, "RENDER: could not write %s: %s", output_path, strerror(errno));
+        ok = false;
+    }
+    return ok;
+}
@@ -0,0 +1,38 @@
+#ifndef RENDER_STATS_H_
+#define RENDER_STATS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Where the time of every rendered frame goes. The stages are measured back to back with a monotonic
+// clock: render_stats_mark() charges everything since the previous mark to the given stage. The
+// readback is pipelined, so the readback and send stages of a frame work on a frame from a few
+// iterations ago, which is still the cost of producing one frame.
+typedef enum {
+    RENDER_STAGE_UPDATE,   // plug_update() recording the draw calls
+    RENDER_STAGE_FLUSH,    // submitting the batched draw calls to the GPU
+    RENDER_STAGE_SOUND,    // queueing the sound of the frame
+    RENDER_STAGE_READBACK, // waiting for the pixels of the oldest frame in the readback ring
+    RENDER_STAGE_SEND,     // flipping/converting the pixels into the ffmpeg queue, includes waiting for free space in it
+    RENDER_STAGE_PUSH,     // scheduling the readback of the new frame
+    COUNT_RENDER_STAGES,
+} Render_Stage;
+
+typedef struct Render_Stats Render_Stats;
+
+// csv_path is optional, when it's given every frame gets a row with its stage timings in milliseconds.
+// The rows are numbered from first_frame, which is where the render started in the animation.
+Render_Stats *render_stats_create(const char *csv_path, size_t first_frame);
+void render_stats_destroy(Render_Stats *rs);
+void render_stats_begin_frame(Render_Stats *rs);
+// Does nothing outside of render_stats_begin_frame()/render_stats_end_frame()
+void render_stats_mark(Render_Stats *rs, Render_Stage stage);
+// How many tasks the plugin updated during the current frame, if it tells us
+void render_stats_count_tasks(Render_Stats *rs, size_t count);
+void render_stats_end_frame(Render_Stats *rs);
+// Logs mean/p50/p99/max of every stage, the overall frame rate and the updated tasks per frame
+void render_stats_report(Render_Stats *rs);
+// Joins the CSVs of the workers of a parallel render into one, in the given order
+bool render_stats_concat_csv(const char *output_path, const char **csv_paths, size_t csv_paths_count);
+
+#endif // RENDER_STATS_H_
@@ -105,6 +105,7 @@ void plug_reset(void)
 
     Arena *a = &p->state_arena;
     p->task = loading(a);
+    arena_trim(a);
 }
 
 void plug_init(void)
@@ -161,10 +162,48 @@ void plug_update(Env env)
     EndMode2D();
 }
 
+void plug_seek(Ticks t)
+{
+    p->finished = task_seek(p->task, t) >= 0;
+}
+
+void *plug_snapshot(void)
+{
+    size_t arena_size = arena_save_size(&p->state_arena);
+    char *snapshot = malloc(sizeof(*p) + arena_size);
+    assert(snapshot != NULL && "Buy MORE RAM lol!!");
+    memcpy(snapshot, p, sizeof(*p));
+    arena_save(&p->state_arena, snapshot + sizeof(*p));
+    return snapshot;
+}
+
+void plug_restore(void *snapshot)
+{
+    // The tasks in the state arena point into the Plug, but the assets stay as they are
+    Plug restored;
+    memcpy(&restored, snapshot, sizeof(restored));
+    restored.font = p->font;
+    restored.asset_arena = p->asset_arena;
+    restored.state_arena = p->state_arena;
+    *p = restored;
+    arena_load(&p->state_arena, (char*)snapshot + sizeof(*p));
+}
+
 bool plug_finished(void)
 {
     return p->finished;
 }
 
+size_t plug_arenas(Plug_Arena *arenas, size_t capacity)
+{
+    Plug_Arena all[] = {
+        {"state", &p->state_arena},
+        {"assets", &p->asset_arena},
+    };
+    size_t count = sizeof(all)/sizeof(all[0]);
+    memcpy(arenas, all, sizeof(all[0])*(count < capacity ? count : capacity));
+    return count;
+}
+
 #define ARENA_IMPLEMENTATION
 #include "arena.h"
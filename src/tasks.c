@@ -1,19 +1,47 @@
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
 #include "tasks.h"
 #include "interpolators.h"
+#include "interp_lut.h"
 
 #include "raymath.h"
 
 Task_VTable task_vtable = {0};
+Easings easings = {0};
+size_t task_update_count = 0;
 Tag TASK_MOVE_SCALAR_TAG = 0;
 Tag TASK_MOVE_VEC2_TAG = 0;
 Tag TASK_MOVE_VEC4_TAG = 0;
 Tag TASK_SEQ_TAG = 0;
 Tag TASK_GROUP_TAG = 0;
 Tag TASK_WAIT_TAG = 0;
+Tag TASK_MOVE_BATCH_TAG = 0;
+Tag TASK_GROUP_PARALLEL_TAG = 0;
+
+Ticks task_advance(Task task, Env env)
+{
+    Task_Funcs *funcs = &task_vtable.items[task.tag];
+    task_update_count += 1;
+    if (env.trace_begin == NULL) return funcs->advance(task.data, env);
+
+    env.trace_begin(funcs->name ? funcs->name : TextFormat("task %zu", task.tag));
+    Ticks left = funcs->advance(task.data, env);
+    env.trace_end();
+    return left;
+}
 
 bool task_update(Task task, Env env)
 {
-    return task_vtable.items[task.tag].update(task.data, env);
+    return task_advance(task, env) >= 0;
+}
+
+Ticks task_seek(Task task, Ticks t)
+{
+    task_seek_data_t seek = task_vtable.items[task.tag].seek;
+    if (seek == NULL) return -1;
+    return seek(task.data, t);
 }
 
 Tag task_vtable_register(Arena *a, Task_Funcs funcs)
@@ -26,25 +54,126 @@ Tag task_vtable_register(Arena *a, Task_Funcs funcs)
 void task_vtable_rebuild(Arena *a)
 {
     memset(&task_vtable, 0, sizeof(task_vtable));
+    memset(&easings, 0, sizeof(easings));
 
     TASK_WAIT_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)wait_update,
+        .name = "wait",
+        .advance = (task_advance_data_t)wait_update,
+        .seek = (task_seek_data_t)wait_seek,
+        .pure = true,
     });
     TASK_MOVE_SCALAR_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)move_scalar_update,
+        .name = "move_scalar",
+        .advance = (task_advance_data_t)move_scalar_update,
+        .seek = (task_seek_data_t)move_scalar_seek,
+        .pure = true,
     });
     TASK_MOVE_VEC2_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)move_vec2_update,
+        .name = "move_vec2",
+        .advance = (task_advance_data_t)move_vec2_update,
+        .seek = (task_seek_data_t)move_vec2_seek,
+        .pure = true,
     });
     TASK_MOVE_VEC4_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)move_vec4_update,
+        .name = "move_vec4",
+        .advance = (task_advance_data_t)move_vec4_update,
+        .seek = (task_seek_data_t)move_vec4_seek,
+        .pure = true,
     });
     TASK_SEQ_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)seq_update,
+        .name = "seq",
+        .advance = (task_advance_data_t)seq_update,
+        .seek = (task_seek_data_t)seq_seek,
     });
     TASK_GROUP_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)group_update,
+        .name = "group",
+        .advance = (task_advance_data_t)group_update,
+        .seek = (task_seek_data_t)group_seek,
     });
+    TASK_MOVE_BATCH_TAG = task_vtable_register(a, (Task_Funcs) {
+        .name = "move_batch",
+        .advance = (task_advance_data_t)move_batch_update,
+        .seek = (task_seek_data_t)move_batch_seek,
+        .pure = true,
+    });
+    TASK_GROUP_PARALLEL_TAG = task_vtable_register(a, (Task_Funcs) {
+        .name = "group_parallel",
+        .advance = (task_advance_data_t)group_parallel_update,
+        .seek = (task_seek_data_t)group_parallel_seek,
+    });
+}
+
+Interp_Func easing_register_bezier(Arena *a, const char *name, Vector2 nodes[4])
+{
+    Vector2 curve[4] = {nodes[0], nodes[1], nodes[2], nodes[3]};
+    if (curve[3].x <= curve[0].x) {
+        TraceLog(LOG_WARNING, "Easing %s does not go from left to right, using a straight line instead", name);
+        curve[1] = curve[0];
+        curve[2] = curve[3];
+        curve[3].x = curve[0].x + 1;
+    }
+    for (size_t i = 1; i <= 2; ++i) {
+        float x = Clamp(curve[i].x, curve[0].x, curve[3].x);
+        if (x != curve[i].x) {
+            TraceLog(LOG_WARNING, "Easing %s: x of node %zu is outside of the curve, clamping it", name, i);
+            curve[i].x = x;
+        }
+    }
+
+    Easing easing = {
+        .name = arena_strdup(a, name),
+        .lut = (float*)arena_alloc(a, sizeof(float)*(INTERP_LUT_SIZE + 1)),
+    };
+    for (size_t i = 0; i <= INTERP_LUT_SIZE; ++i) {
+        float x = Lerp(curve[0].x, curve[3].x, (float)i/INTERP_LUT_SIZE);
+        easing.lut[i] = cubic_bezier(cuber_bezier_newton(x, curve, 32), curve).y;
+    }
+    easing.lut[0] = curve[0].y;
+    easing.lut[INTERP_LUT_SIZE] = curve[3].y;
+
+    assert(easings.count < FUNC_CUSTOM_MAX - COUNT_INTERP_FUNCS && "Too many easings");
+    Interp_Func func = (Interp_Func)(COUNT_INTERP_FUNCS + easings.count);
+    arena_da_append(a, &easings, easing);
+    return func;
+}
+
+Interp_Func easing_load_bezier(Arena *a, const char *file_path, Interp_Func fallback)
+{
+    char *text = LoadFileText(file_path);
+    if (text == NULL) return fallback;
+
+    Vector2 nodes[4];
+    const char *cursor = text;
+    for (size_t i = 0; i < 4; ++i) {
+        char *end = NULL;
+        nodes[i].x = strtof(cursor, &end);
+        if (end == cursor) goto invalid;
+        cursor = end;
+        nodes[i].y = strtof(cursor, &end);
+        if (end == cursor) goto invalid;
+        cursor = end;
+    }
+    UnloadFileText(text);
+    return easing_register_bezier(a, file_path, nodes);
+
+invalid:
+    TraceLog(LOG_WARNING, "%s: expected 4 nodes of the curve with 2 floats each", file_path);
+    UnloadFileText(text);
+    return fallback;
+}
+
+const float *easing_lut(Interp_Func func)
+{
+    if (func < COUNT_INTERP_FUNCS) return interp_luts[func];
+    size_t index = func - COUNT_INTERP_FUNCS;
+    assert(index < easings.count && "Easing was not registered");
+    return easings.items[index].lut;
+}
+
+float easing_interp(Interp_Func func, float t)
+{
+    if (func < COUNT_INTERP_FUNCS) return interp_func_lut(func, t);
+    return interp_lut_eval(easing_lut(func), t);
 }
 
 bool wait_done(Wait_Data *data)
@@ -56,25 +185,42 @@ float wait_interp(Wait_Data *data)
 {
     float t = 0.0f;
     if (data->duration > 0) {
-        t = data->cursor/data->duration;
+        t = (float)((double)data->cursor/data->duration);
     }
     return t;
 }
 
-bool wait_update(Wait_Data *data, Env env)
+Ticks wait_update(Wait_Data *data, Env env)
 {
-    if (wait_done(data)) return true;
+    if (wait_done(data)) return env.delta_ticks;
     if (!data->started) data->started = true;
-    data->cursor += env.delta_time;
-    return wait_done(data);
+    data->cursor += env.delta_ticks;
+    if (data->cursor < data->duration) return -1;
+    // Clamped, so the last frame of a move lands exactly on its target instead of overshooting it.
+    // The overshoot goes to the next task instead.
+    Ticks left = data->cursor - data->duration;
+    data->cursor = data->duration;
+    return left;
 }
 
-Wait_Data wait_data(float duration)
+Ticks wait_seek(Wait_Data *data, Ticks t)
 {
-    return (Wait_Data) { .duration = duration };
+    if (t <= 0) {
+        data->started = false;
+        data->cursor = 0;
+        return -1;
+    }
+    data->started = true;
+    data->cursor = t < data->duration ? t : data->duration;
+    return t - data->duration;
 }
 
-Task task_wait(Arena *a, float duration)
+Wait_Data wait_data(double duration)
+{
+    return (Wait_Data) { .duration = ticks_from_secs(duration) };
+}
+
+Task task_wait(Arena *a, double duration)
 {
     Wait_Data data = wait_data(duration);
     return (Task) {
@@ -83,27 +229,52 @@ Task task_wait(Arena *a, float duration)
     };
 }
 
-bool move_scalar_update(Move_Scalar_Data *data, Env env)
+Ticks move_scalar_update(Move_Scalar_Data *data, Env env)
 {
-    if (wait_done(&data->wait)) return true;
+    if (wait_done(&data->wait)) return env.delta_ticks;
+
+    if (!data->wait.started && data->value) {
+        data->start = *data->value;
+    }
+
+    Ticks left = wait_update(&data->wait, env);
+
+    if (data->value) {
+        *data->value = Lerp(
+            data->start,
+            data->target,
+            easing_interp(data->func, wait_interp(&data->wait)));
+    }
+
+    return left;
+}
+
+Ticks move_scalar_seek(Move_Scalar_Data *data, Ticks t)
+{
+    if (t <= 0) {
+        if (data->wait.started && data->value) {
+            *data->value = data->start;
+        }
+        return wait_seek(&data->wait, t);
+    }
 
     if (!data->wait.started && data->value) {
         data->start = *data->value;
     }
 
-    bool finished = wait_update(&data->wait, env);
+    Ticks left = wait_seek(&data->wait, t);
 
     if (data->value) {
         *data->value = Lerp(
             data->start,
             data->target,
-            interp_func(data->func, wait_interp(&data->wait)));
+            easing_interp(data->func, wait_interp(&data->wait)));
     }
 
-    return finished;
+    return left;
 }
 
-Move_Scalar_Data move_scalar_data(float *value, float target, float duration, Interp_Func func)
+Move_Scalar_Data move_scalar_data(float *value, float target, double duration, Interp_Func func)
 {
     return (Move_Scalar_Data) {
         .wait = wait_data(duration),
@@ -113,7 +284,7 @@ Move_Scalar_Data move_scalar_data(float *value, float target, float duration, In
     };
 }
 
-Task task_move_scalar(Arena *a, float *value, float target, float duration, Interp_Func func)
+Task task_move_scalar(Arena *a, float *value, float target, double duration, Interp_Func func)
 {
     Move_Scalar_Data data = move_scalar_data(value, target, duration, func);
     return (Task) {
@@ -122,26 +293,51 @@ Task task_move_scalar(Arena *a, float *value, float target, float duration, Inte
     };
 }
 
-bool move_vec2_update(Move_Vec2_Data *data, Env env)
+Ticks move_vec2_update(Move_Vec2_Data *data, Env env)
 {
-    if (wait_done(&data->wait)) return true;
+    if (wait_done(&data->wait)) return env.delta_ticks;
 
     if (!data->wait.started && data->value) {
         data->start = *data->value;
     }
 
-    bool finished = wait_update(&data->wait, env);
+    Ticks left = wait_update(&data->wait, env);
 
     if (data->value) {
         *data->value = Vector2Lerp(
             data->start,
             data->target,
-            interp_func(data->func, wait_interp(&data->wait)));
+            easing_interp(data->func, wait_interp(&data->wait)));
     }
-    return finished;
+    return left;
 }
 
-Move_Vec2_Data move_vec2_data(Vector2 *value, Vector2 target, float duration, Interp_Func func)
+Ticks move_vec2_seek(Move_Vec2_Data *data, Ticks t)
+{
+    if (t <= 0) {
+        if (data->wait.started && data->value) {
+            *data->value = data->start;
+        }
+        return wait_seek(&data->wait, t);
+    }
+
+    if (!data->wait.started && data->value) {
+        data->start = *data->value;
+    }
+
+    Ticks left = wait_seek(&data->wait, t);
+
+    if (data->value) {
+        *data->value = Vector2Lerp(
+            data->start,
+            data->target,
+            easing_interp(data->func, wait_interp(&data->wait)));
+    }
+
+    return left;
+}
+
+Move_Vec2_Data move_vec2_data(Vector2 *value, Vector2 target, double duration, Interp_Func func)
 {
     return (Move_Vec2_Data) {
         .wait = wait_data(duration),
@@ -151,7 +347,7 @@ Move_Vec2_Data move_vec2_data(Vector2 *value, Vector2 target, float duration, In
     };
 }
 
-Task task_move_vec2(Arena *a, Vector2 *value, Vector2 target, float duration, Interp_Func func)
+Task task_move_vec2(Arena *a, Vector2 *value, Vector2 target, double duration, Interp_Func func)
 {
     Move_Vec2_Data data = move_vec2_data(value, target, duration, func);
     return (Task) {
@@ -160,27 +356,52 @@ Task task_move_vec2(Arena *a, Vector2 *value, Vector2 target, float duration, In
     };
 }
 
-bool move_vec4_update(Move_Vec4_Data *data, Env env)
+Ticks move_vec4_update(Move_Vec4_Data *data, Env env)
 {
-    if (wait_done(&data->wait)) return true;
+    if (wait_done(&data->wait)) return env.delta_ticks;
 
     if (!data->wait.started && data->value) {
         data->start = *data->value;
     }
 
-    bool finished = wait_update(&data->wait, env);
+    Ticks left = wait_update(&data->wait, env);
 
     if (data->value) {
         *data->value = QuaternionLerp(
             data->start,
             data->target,
-            interp_func(data->func, wait_interp(&data->wait)));
+            easing_interp(data->func, wait_interp(&data->wait)));
     }
 
-    return finished;
+    return left;
 }
 
-Move_Vec4_Data move_vec4_data(Vector4 *value, Vector4 target, float duration, Interp_Func func)
+Ticks move_vec4_seek(Move_Vec4_Data *data, Ticks t)
+{
+    if (t <= 0) {
+        if (data->wait.started && data->value) {
+            *data->value = data->start;
+        }
+        return wait_seek(&data->wait, t);
+    }
+
+    if (!data->wait.started && data->value) {
+        data->start = *data->value;
+    }
+
+    Ticks left = wait_seek(&data->wait, t);
+
+    if (data->value) {
+        *data->value = QuaternionLerp(
+            data->start,
+            data->target,
+            easing_interp(data->func, wait_interp(&data->wait)));
+    }
+
+    return left;
+}
+
+Move_Vec4_Data move_vec4_data(Vector4 *value, Vector4 target, double duration, Interp_Func func)
 {
     return (Move_Vec4_Data) {
         .wait = wait_data(duration),
@@ -190,7 +411,7 @@ Move_Vec4_Data move_vec4_data(Vector4 *value, Vector4 target, float duration, In
     };
 }
 
-Task task_move_vec4(Arena *a, Vector4 *value, Vector4 target, float duration, Interp_Func func)
+Task task_move_vec4(Arena *a, Vector4 *value, Vector4 target, double duration, Interp_Func func)
 {
     Move_Vec4_Data data = move_vec4_data(value, target, duration, func);
     return (Task) {
@@ -199,16 +420,256 @@ Task task_move_vec4(Arena *a, Vector4 *value, Vector4 target, float duration, In
     };
 }
 
-bool group_update(Group_Data *data, Env env)
+static void move_batch_swap(Move_Batch_Data *data, size_t i, size_t j)
 {
-    bool finished = true;
-    for (size_t i = 0; i < data->tasks.count; ++i) {
-        Task it = data->tasks.items[i];
-        if (!task_update(it, env)) {
-            finished = false;
+    if (i == j) return;
+#define SWAP(type, a, b) do { type tmp = (a); (a) = (b); (b) = tmp; } while (0)
+    SWAP(float*, data->value[i], data->value[j]);
+    for (size_t k = 0; k < data->dim; ++k) {
+        SWAP(float, data->start[i*data->dim + k], data->start[j*data->dim + k]);
+        SWAP(float, data->target[i*data->dim + k], data->target[j*data->dim + k]);
+    }
+    SWAP(Ticks, data->cursor[i], data->cursor[j]);
+    SWAP(Ticks, data->duration[i], data->duration[j]);
+    SWAP(Interp_Func, data->func[i], data->func[j]);
+#undef SWAP
+}
+
+// Moves the finished moves behind the running ones. The running ones keep their order, so they stay
+// grouped by their easing.
+static void move_batch_retire(Move_Batch_Data *data)
+{
+    size_t active = 0;
+    for (size_t i = 0; i < data->active; ++i) {
+        if (data->cursor[i] < data->duration[i]) move_batch_swap(data, i, active++);
+    }
+    data->active = active;
+}
+
+// Groups the running moves by their easing, one pass per distinct easing
+static void move_batch_sort(Move_Batch_Data *data)
+{
+    size_t sorted = 0;
+    while (sorted < data->active) {
+        Interp_Func func = data->func[sorted];
+        for (size_t i = sorted + 1; i < data->active; ++i) {
+            if (data->func[i] < func) func = data->func[i];
+        }
+        for (size_t i = sorted; i < data->active; ++i) {
+            if (data->func[i] == func) move_batch_swap(data, i, sorted++);
         }
     }
-    return finished;
+}
+
+static void move_batch_capture_start(Move_Batch_Data *data)
+{
+    for (size_t i = 0; i < data->count; ++i) {
+        memcpy(&data->start[i*data->dim], data->value[i], sizeof(float)*data->dim);
+    }
+    data->started = true;
+    move_batch_sort(data);
+}
+
+// Eases the moves [begin, end) that all share func. Same as easing_interp(), but the easing is picked
+// once for the whole run, so every kind of easing is a single loop without branches or calls in it.
+static void move_batch_ease_run(Move_Batch_Data *data, Interp_Func func, size_t begin, size_t end)
+{
+    float *eased = data->eased;
+    const Ticks *cursor = data->cursor;
+    const Ticks *duration = data->duration;
+    for (size_t i = begin; i < end; ++i) {
+        eased[i] = duration[i] > 0 ? (float)((double)cursor[i]/duration[i]) : 0.0f;
+    }
+
+    if (func < COUNT_INTERP_FUNCS && !interp_func_tabulated(func)) {
+        switch (func) {
+        case FUNC_ID:
+            break;
+        case FUNC_SQR:
+            for (size_t i = begin; i < end; ++i) eased[i] = eased[i]*eased[i];
+            break;
+        case FUNC_SQRT:
+            for (size_t i = begin; i < end; ++i) eased[i] = sqrtf(eased[i]);
+            break;
+        case FUNC_SMOOTHSTEP:
+            for (size_t i = begin; i < end; ++i) eased[i] = smoothstep(eased[i]);
+            break;
+        default:
+            assert(0 && "UNREACHABLE");
+        }
+        return;
+    }
+
+    const float *lut = easing_lut(func);
+    for (size_t i = begin; i < end; ++i) eased[i] = interp_lut_eval(lut, eased[i]);
+}
+
+// The moves [0, n) are grouped by their easing, so this is one tight loop per easing in use
+static void move_batch_ease(Move_Batch_Data *data, size_t n)
+{
+    size_t end = 0;
+    for (size_t begin = 0; begin < n; begin = end) {
+        Interp_Func func = data->func[begin];
+        for (end = begin + 1; end < n && data->func[end] == func; ++end);
+        move_batch_ease_run(data, func, begin, end);
+    }
+}
+
+// dim is a constant at every call site, so the inner loop gets unrolled
+static inline void move_batch_store_dim(Move_Batch_Data *data, size_t n, size_t dim)
+{
+    const float *start = data->start;
+    const float *target = data->target;
+    const float *eased = data->eased;
+    for (size_t i = 0; i < n; ++i) {
+        float *value = data->value[i];
+        for (size_t k = 0; k < dim; ++k) {
+            float s = start[i*dim + k];
+            value[k] = s + eased[i]*(target[i*dim + k] - s);
+        }
+    }
+}
+
+static void move_batch_store(Move_Batch_Data *data, size_t n)
+{
+    switch (data->dim) {
+    case 1: move_batch_store_dim(data, n, 1); break;
+    case 2: move_batch_store_dim(data, n, 2); break;
+    case 4: move_batch_store_dim(data, n, 4); break;
+    default: assert(0 && "UNREACHABLE");
+    }
+}
+
+Ticks move_batch_update(Move_Batch_Data *data, Env env)
+{
+    if (!data->started) move_batch_capture_start(data);
+
+    // The batch finishes together with its longest move, which leaves the least of the frame
+    Ticks left = env.delta_ticks;
+    size_t n = data->active;
+    Ticks *cursor = data->cursor;
+    const Ticks *duration = data->duration;
+    for (size_t i = 0; i < n; ++i) {
+        Ticks c = cursor[i] + env.delta_ticks;
+        if (c >= duration[i] && c - duration[i] < left) left = c - duration[i];
+        cursor[i] = c < duration[i] ? c : duration[i];
+    }
+    move_batch_ease(data, n);
+    move_batch_store(data, n);
+    move_batch_retire(data);
+
+    return data->active == 0 ? left : -1;
+}
+
+Ticks move_batch_seek(Move_Batch_Data *data, Ticks t)
+{
+    if (t <= 0) {
+        if (data->started) {
+            for (size_t i = data->count; i > 0; --i) {
+                memcpy(data->value[i - 1], &data->start[(i - 1)*data->dim], sizeof(float)*data->dim);
+            }
+        }
+        data->started = false;
+        memset(data->cursor, 0, sizeof(*data->cursor)*data->count);
+        data->active = data->count;
+        move_batch_retire(data);
+        return -1;
+    }
+
+    if (!data->started) move_batch_capture_start(data);
+
+    Ticks longest = 0;
+    for (size_t i = 0; i < data->count; ++i) {
+        data->cursor[i] = t < data->duration[i] ? t : data->duration[i];
+        if (data->duration[i] > longest) longest = data->duration[i];
+    }
+    data->active = data->count;
+    move_batch_sort(data);
+    move_batch_ease(data, data->count);
+    move_batch_store(data, data->count);
+    move_batch_retire(data);
+
+    return t - longest;
+}
+
+Task task_move_batch(Arena *a, size_t dim, size_t capacity)
+{
+    assert((dim == 1 || dim == 2 || dim == 4) && "Only scalars, Vector2-s and Vector4-s can be batched");
+    Move_Batch_Data *data = (Move_Batch_Data*)arena_alloc(a, sizeof(*data));
+    memset(data, 0, sizeof(*data));
+    data->dim = dim;
+    data->capacity = capacity;
+    data->value = (float**)arena_alloc(a, sizeof(*data->value)*capacity);
+    data->start = (float*)arena_alloc(a, sizeof(*data->start)*capacity*dim);
+    data->target = (float*)arena_alloc(a, sizeof(*data->target)*capacity*dim);
+    data->cursor = (Ticks*)arena_alloc(a, sizeof(*data->cursor)*capacity);
+    data->duration = (Ticks*)arena_alloc(a, sizeof(*data->duration)*capacity);
+    data->func = (Interp_Func*)arena_alloc(a, sizeof(*data->func)*capacity);
+    data->eased = (float*)arena_alloc(a, sizeof(*data->eased)*capacity);
+
+    return (Task) {
+        .tag = TASK_MOVE_BATCH_TAG,
+        .data = data,
+    };
+}
+
+void task_move_batch_add(Task batch, float *value, const float *target, double duration, Interp_Func func)
+{
+    assert(batch.tag == TASK_MOVE_BATCH_TAG);
+    Move_Batch_Data *data = (Move_Batch_Data*)batch.data;
+    assert(!data->started && "Cannot add moves to a batch that already started");
+    assert(data->count < data->capacity && "Move batch capacity exceeded");
+    assert(value != NULL);
+
+    size_t i = data->count++;
+    data->value[i] = value;
+    memcpy(&data->target[i*data->dim], target, sizeof(float)*data->dim);
+    data->cursor[i] = 0;
+    data->duration[i] = ticks_from_secs(duration);
+    data->func[i] = func;
+    if (data->duration[i] > 0) {
+        move_batch_swap(data, i, data->active);
+        data->active += 1;
+    }
+}
+
+Ticks group_update(Group_Data *data, Env env)
+{
+    // The group finishes together with its longest child, which leaves the least of the frame
+    Ticks left = env.delta_ticks;
+    size_t active_count = 0;
+    for (size_t i = 0; i < data->active_count; ++i) {
+        size_t index = data->active[i];
+        Ticks it_left = task_advance(data->tasks.items[index], env);
+        if (it_left < 0) {
+            data->active[active_count++] = index;
+        } else if (it_left < left) {
+            left = it_left;
+        }
+    }
+    data->active_count = active_count;
+    return active_count == 0 ? left : -1;
+}
+
+Ticks group_seek(Group_Data *data, Ticks t)
+{
+    // Rewinding in reverse order restores values shared by several children to what the first one saw
+    for (size_t i = data->tasks.count; i > 0; --i) {
+        task_seek(data->tasks.items[i - 1], 0);
+    }
+    data->active_count = 0;
+    if (t <= 0) {
+        for (size_t i = 0; i < data->tasks.count; ++i) data->active[data->active_count++] = i;
+        return data->tasks.count > 0 ? -1 : t;
+    }
+
+    Ticks left = t;
+    for (size_t i = 0; i < data->tasks.count; ++i) {
+        Ticks it_left = task_seek(data->tasks.items[i], t);
+        if (it_left < left) left = it_left;
+        if (it_left < 0) data->active[data->active_count++] = i;
+    }
+    return left;
 }
 
 Task task_group_(Arena *a, ...)
@@ -225,22 +686,220 @@ Task task_group_(Arena *a, ...)
     }
     va_end(args);
 
+    data->active = (size_t*)arena_alloc(a, sizeof(*data->active)*data->tasks.count);
+    for (size_t i = 0; i < data->tasks.count; ++i) data->active[data->active_count++] = i;
+
     return (Task) {
         .tag = TASK_GROUP_TAG,
         .data = data,
     };
 }
 
-bool seq_update(Seq_Data *data, Env env)
+// Groups with fewer active children are not worth waking up the threads
+#define GROUP_PARALLEL_MIN_CHILDREN 1024
+// Amount of children a thread claims at once
+#define GROUP_PARALLEL_CHUNK 256
+#define TASK_POOL_MAX_THREADS 64
+
+// Threads of task_group_parallel(). Started on the first parallel update and stopped when the plugin
+// is unloaded, so none of them are left running the code of the unloaded plugin after the hot reload.
+typedef struct {
+    bool started;
+    bool quit;
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    pthread_t threads[TASK_POOL_MAX_THREADS];
+    size_t threads_count;
+    size_t generation;          // Bumped for every job, so the threads know there is a new one
+    size_t busy;                // Threads that didn't finish the current job yet
+    Group_Parallel_Data *job;
+    Env env;
+    size_t next;                // Index of the next chunk of children to claim, atomic
+} Task_Pool;
+
+static Task_Pool task_pool = {0};
+
+static void group_parallel_work(Group_Parallel_Data *data, Env env)
+{
+    Group_Data *group = &data->group;
+    size_t updated = 0;
+    for (;;) {
+        size_t begin = __atomic_fetch_add(&task_pool.next, GROUP_PARALLEL_CHUNK, __ATOMIC_RELAXED);
+        if (begin >= group->active_count) break;
+        size_t end = begin + GROUP_PARALLEL_CHUNK;
+        if (end > group->active_count) end = group->active_count;
+
+        if (env.trace_begin) env.trace_begin("group_parallel chunk");
+        for (size_t i = begin; i < end; ++i) {
+            size_t index = group->active[i];
+            Task it = group->tasks.items[index];
+            Task_Funcs *funcs = &task_vtable.items[it.tag];
+            if (!funcs->pure) continue;
+            data->left[index] = funcs->advance(it.data, env);
+            updated += 1;
+        }
+        if (env.trace_end) env.trace_end();
+    }
+    __atomic_fetch_add(&task_update_count, updated, __ATOMIC_RELAXED);
+}
+
+static void *task_pool_thread(void *arg)
+{
+    (void)arg;
+    size_t generation = 0;
+    pthread_mutex_lock(&task_pool.mutex);
+    for (;;) {
+        while (!task_pool.quit && task_pool.generation == generation) {
+            pthread_cond_wait(&task_pool.work_cond, &task_pool.mutex);
+        }
+        if (task_pool.quit) break;
+        generation = task_pool.generation;
+        Group_Parallel_Data *job = task_pool.job;
+        Env env = task_pool.env;
+        pthread_mutex_unlock(&task_pool.mutex);
+
+        group_parallel_work(job, env);
+
+        pthread_mutex_lock(&task_pool.mutex);
+        task_pool.busy -= 1;
+        if (task_pool.busy == 0) pthread_cond_signal(&task_pool.done_cond);
+    }
+    pthread_mutex_unlock(&task_pool.mutex);
+    return NULL;
+}
+
+static void task_pool_start(void)
+{
+    pthread_mutex_init(&task_pool.mutex, NULL);
+    pthread_cond_init(&task_pool.work_cond, NULL);
+    pthread_cond_init(&task_pool.done_cond, NULL);
+    task_pool.started = true;
+
+    // The calling thread works too
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t wanted = cpus > 1 ? (size_t)cpus - 1 : 0;
+    if (wanted > TASK_POOL_MAX_THREADS) wanted = TASK_POOL_MAX_THREADS;
+    for (size_t i = 0; i < wanted; ++i) {
+        if (pthread_create(&task_pool.threads[task_pool.threads_count], NULL, task_pool_thread, NULL) != 0) {
+            TraceLog(LOG_WARNING, "TASKS: could not start task thread, using %zu threads", task_pool.threads_count);
+            break;
+        }
+        task_pool.threads_count += 1;
+    }
+}
+
+__attribute__((destructor))
+static void task_pool_stop(void)
 {
-    if (data->it >= data->tasks.count) return true;
+    if (!task_pool.started) return;
+    pthread_mutex_lock(&task_pool.mutex);
+    task_pool.quit = true;
+    pthread_cond_broadcast(&task_pool.work_cond);
+    pthread_mutex_unlock(&task_pool.mutex);
+    for (size_t i = 0; i < task_pool.threads_count; ++i) {
+        pthread_join(task_pool.threads[i], NULL);
+    }
+    pthread_cond_destroy(&task_pool.done_cond);
+    pthread_cond_destroy(&task_pool.work_cond);
+    pthread_mutex_destroy(&task_pool.mutex);
+    memset(&task_pool, 0, sizeof(task_pool));
+}
 
-    Task it = data->tasks.items[data->it];
-    if (task_update(it, env)) {
+Ticks group_parallel_update(Group_Parallel_Data *data, Env env)
+{
+    Group_Data *group = &data->group;
+    if (group->active_count < GROUP_PARALLEL_MIN_CHILDREN) return group_update(group, env);
+
+    if (!task_pool.started) task_pool_start();
+
+    pthread_mutex_lock(&task_pool.mutex);
+    task_pool.job = data;
+    task_pool.env = env;
+    task_pool.next = 0;
+    task_pool.busy = task_pool.threads_count;
+    task_pool.generation += 1;
+    pthread_cond_broadcast(&task_pool.work_cond);
+    pthread_mutex_unlock(&task_pool.mutex);
+
+    group_parallel_work(data, env);
+
+    pthread_mutex_lock(&task_pool.mutex);
+    while (task_pool.busy > 0) pthread_cond_wait(&task_pool.done_cond, &task_pool.mutex);
+    task_pool.job = NULL;
+    pthread_mutex_unlock(&task_pool.mutex);
+
+    Ticks left = env.delta_ticks;
+    size_t active_count = 0;
+    for (size_t i = 0; i < group->active_count; ++i) {
+        size_t index = group->active[i];
+        Task it = group->tasks.items[index];
+        Ticks it_left = task_vtable.items[it.tag].pure ? data->left[index] : task_advance(it, env);
+        if (it_left < 0) {
+            group->active[active_count++] = index;
+        } else if (it_left < left) {
+            left = it_left;
+        }
+    }
+    group->active_count = active_count;
+    return active_count == 0 ? left : -1;
+}
+
+Ticks group_parallel_seek(Group_Parallel_Data *data, Ticks t)
+{
+    return group_seek(&data->group, t);
+}
+
+Task task_group_parallel(Arena *a, Tasks tasks)
+{
+    Group_Parallel_Data *data = (Group_Parallel_Data*)arena_alloc(a, sizeof(*data));
+    memset(data, 0, sizeof(*data));
+    data->group.tasks = tasks;
+    data->group.active = (size_t*)arena_alloc(a, sizeof(*data->group.active)*tasks.count);
+    for (size_t i = 0; i < tasks.count; ++i) data->group.active[data->group.active_count++] = i;
+    data->left = (Ticks*)arena_alloc(a, sizeof(*data->left)*tasks.count);
+    memset(data->left, 0, sizeof(*data->left)*tasks.count);
+
+    return (Task) {
+        .tag = TASK_GROUP_PARALLEL_TAG,
+        .data = data,
+    };
+}
+
+Ticks seq_update(Seq_Data *data, Env env)
+{
+    // Every child starts exactly when the previous one finished, so whatever is left of the frame
+    // after a child goes to the next one, just like in seq_seek()
+    while (data->it < data->tasks.count) {
+        Ticks left = task_advance(data->tasks.items[data->it], env);
+        if (left < 0) return left;
         data->it += 1;
+        if (left == 0 && data->it < data->tasks.count) return -1;
+        env.time_ticks += env.delta_ticks - left;
+        env.delta_ticks = left;
+        env.delta_time = (float)secs_from_ticks(left);
     }
+    return env.delta_ticks;
+}
 
-    return data->it >= data->tasks.count;
+Ticks seq_seek(Seq_Data *data, Ticks t)
+{
+    for (size_t i = data->tasks.count; i > 0; --i) {
+        task_seek(data->tasks.items[i - 1], 0);
+    }
+    data->it = 0;
+    if (t <= 0) return data->tasks.count > 0 ? -1 : t;
+
+    // Every child starts exactly when the previous one finished, so whatever time is
+    // left after a child is carried over to the next one, just like in seq_update()
+    Ticks left = t;
+    while (data->it < data->tasks.count) {
+        left = task_seek(data->tasks.items[data->it], left);
+        if (left < 0) return left;
+        data->it += 1;
+        if (left == 0 && data->it < data->tasks.count) return -1;
+    }
+    return left;
 }
 
 Task task_seq_(Arena *a, ...)
@@ -12,13 +12,39 @@ typedef struct {
     void *data;
 } Task;
 
-typedef bool (*task_update_data_t)(void*, Env);
+// Both return how much time is left after the task finished (of env.delta_ticks for the advance, of t
+// for the seek), or a negative value if the task is still running. A task that finishes in the middle
+// of a frame hands the rest of the frame to whatever comes after it, so updating frame by frame and
+// seeking to the same time always end up in the same state. Register them without a cast, so the
+// compiler catches a wrong signature like an old bool update.
+typedef Ticks (*task_advance_data_t)(void*, Env);
+typedef Ticks (*task_seek_data_t)(void*, Ticks);
 
 typedef struct {
-    task_update_data_t update;
+    const char *name;           // Optional, shows up in the traces
+    task_advance_data_t advance;
+    task_seek_data_t seek;      // Optional
+    // Only touches its own data and the values it moves, so task_group_parallel() may update it on
+    // another thread at the same time as other pure tasks moving different values
+    bool pure;
 } Task_Funcs;
 
+// How many times task_update() was called. The engine resets it before every frame if the plugin
+// exports it, to see how many tasks the plugin visited (see --stats).
+extern size_t task_update_count;
+
+// Advances the task by env.delta_ticks. Returns how much of env.delta_ticks is left after the task
+// finished, or a negative value if it's still running.
+Ticks task_advance(Task task, Env env);
+// Same as task_advance() but only tells whether the task is finished
 bool task_update(Task task, Env env);
+// Puts the task into the exact state it would have after being advanced frame by frame for t ticks
+// in total since it started, no matter where it is right now. t <= 0 rewinds the task to the state
+// before its first update. Returns how much of t is left after the task finished, or a negative value
+// if the task is not finished by then. A task only starts once it gets some time, so a child of a
+// sequence that follows a child finishing exactly at t is not started yet. Kinds without a seek
+// function are left as they are and are considered still running.
+Ticks task_seek(Task task, Ticks t);
 
 typedef struct {
     Task_Funcs *items;
@@ -33,27 +59,61 @@ extern Tag TASK_MOVE_VEC2_TAG;
 extern Tag TASK_MOVE_VEC4_TAG;
 extern Tag TASK_SEQ_TAG;
 extern Tag TASK_GROUP_TAG;
+extern Tag TASK_MOVE_BATCH_TAG;
+extern Tag TASK_GROUP_PARALLEL_TAG;
 
 Tag task_vtable_register(Arena *a, Task_Funcs funcs);
+// Also forgets all of the registered easings, they live in the same arena
 void task_vtable_rebuild(Arena *a);
 
+// Custom easing curves. Every registered curve gets its own Interp_Func right after the builtin ones,
+// so it can be passed to task_move_*() like any other. The curves are baked into lookup tables when
+// they are registered, so playing them costs the same as the builtin ones. Just like the tags, the
+// easings must be registered again in the same order after every task_vtable_rebuild().
+typedef struct {
+    const char *name;
+    float *lut; // Values of the curve at uniformly spaced x, see interp_lut_eval()
+} Easing;
+
+typedef struct {
+    Easing *items;
+    size_t count;
+    size_t capacity;
+} Easings;
+
+extern Easings easings;
+
+// x of the nodes[1] and nodes[2] is clamped between nodes[0] and nodes[3], so every x has exactly one
+// point on the curve. The curve is stretched horizontally to [0, 1].
+Interp_Func easing_register_bezier(Arena *a, const char *name, Vector2 nodes[4]);
+// Registers the curve from a file saved by the bezier editor (src/bezier.c). Returns fallback if the
+// file could not be loaded.
+Interp_Func easing_load_bezier(Arena *a, const char *file_path, Interp_Func fallback);
+// interp_func() that also knows about the registered easings
+float easing_interp(Interp_Func func, float t);
+// The table of func. easing_interp() only uses it for the custom and the interp_func_tabulated() ones
+const float *easing_lut(Interp_Func func);
+
 typedef struct {
     Task *items;
     size_t count;
     size_t capacity;
 } Tasks;
 
+// The durations are taken in seconds as double, so the usual literals like 0.1 or 1.0/3 turn into the
+// exact amount of ticks, and a wait always takes the same amount of frames.
 typedef struct {
     bool started;
-    float cursor;
-    float duration;
+    Ticks cursor;
+    Ticks duration;
 } Wait_Data;
 
 float wait_interp(Wait_Data *data);
 bool wait_done(Wait_Data *data);
-bool wait_update(Wait_Data *data, Env env);
-Wait_Data wait_data(float duration);
-Task task_wait(Arena *a, float duration);
+Ticks wait_update(Wait_Data *data, Env env);
+Ticks wait_seek(Wait_Data *data, Ticks t);
+Wait_Data wait_data(double duration);
+Task task_wait(Arena *a, double duration);
 
 typedef struct {
     Wait_Data wait;
@@ -62,9 +122,10 @@ typedef struct {
     Interp_Func func;
 } Move_Scalar_Data;
 
-bool move_scalar_update(Move_Scalar_Data *data, Env env);
-Move_Scalar_Data move_scalar_data(float *value, float target, float duration, Interp_Func func);
-Task task_move_scalar(Arena *a, float *value, float target, float duration, Interp_Func);
+Ticks move_scalar_update(Move_Scalar_Data *data, Env env);
+Ticks move_scalar_seek(Move_Scalar_Data *data, Ticks t);
+Move_Scalar_Data move_scalar_data(float *value, float target, double duration, Interp_Func func);
+Task task_move_scalar(Arena *a, float *value, float target, double duration, Interp_Func);
 
 typedef struct {
     Wait_Data wait;
@@ -73,9 +134,10 @@ typedef struct {
     Interp_Func func;
 } Move_Vec2_Data;
 
-bool move_vec2_update(Move_Vec2_Data *data, Env env);
-Move_Vec2_Data move_vec2_data(Vector2 *value, Vector2 target, float duration, Interp_Func func);
-Task task_move_vec2(Arena *a, Vector2 *value, Vector2 target, float duration, Interp_Func func);
+Ticks move_vec2_update(Move_Vec2_Data *data, Env env);
+Ticks move_vec2_seek(Move_Vec2_Data *data, Ticks t);
+Move_Vec2_Data move_vec2_data(Vector2 *value, Vector2 target, double duration, Interp_Func func);
+Task task_move_vec2(Arena *a, Vector2 *value, Vector2 target, double duration, Interp_Func func);
 
 typedef struct {
     Wait_Data wait;
@@ -84,24 +146,76 @@ typedef struct {
     Interp_Func func;
 } Move_Vec4_Data;
 
-bool move_vec4_update(Move_Vec4_Data *data, Env env);
-Move_Vec4_Data move_vec4_data(Vector4 *value, Vector4 target, float duration, Interp_Func func);
-Task task_move_vec4(Arena *a, Vector4 *value, Vector4 target, float duration, Interp_Func func);
+Ticks move_vec4_update(Move_Vec4_Data *data, Env env);
+Ticks move_vec4_seek(Move_Vec4_Data *data, Ticks t);
+Move_Vec4_Data move_vec4_data(Vector4 *value, Vector4 target, double duration, Interp_Func func);
+Task task_move_vec4(Arena *a, Vector4 *value, Vector4 target, double duration, Interp_Func func);
+
+// Many moves of values with the same amount of floats running at the same time, like a group of
+// task_move_*()-s, but stored as a structure of arrays and advanced by one loop per array instead of
+// an indirect call and a separate allocation per move. The running moves are kept in front of the
+// finished ones, so every frame only streams through the moves that still have something to do, and
+// grouped by their easing, so every kind of easing is eased by one loop over its moves.
+typedef struct {
+    size_t dim;         // Floats per value: 1, 2 or 4
+    size_t count;
+    size_t capacity;
+    size_t active;      // The moves [0, active) are running grouped by func, the finished ones are behind them
+    bool started;
+    float **value;
+    float *start;       // dim floats per move
+    float *target;      // dim floats per move
+    Ticks *cursor;
+    Ticks *duration;
+    Interp_Func *func;
+    float *eased;       // Scratch space for the eased time of every move
+} Move_Batch_Data;
+
+Ticks move_batch_update(Move_Batch_Data *data, Env env);
+Ticks move_batch_seek(Move_Batch_Data *data, Ticks t);
+Task task_move_batch(Arena *a, size_t dim, size_t capacity);
+// value and target point to dim floats, like &position.x of a Vector2 in a batch of dim 2.
+// Moves can only be added before the batch started. All of the moves start together, so several of
+// them may only move the same value if they agree on where it goes, otherwise which one wins is
+// unspecified.
+void task_move_batch_add(Task batch, float *value, const float *target, double duration, Interp_Func func);
 
 typedef struct {
     Tasks tasks;
+    // Indices of the children that are not finished yet in their original order, so later children
+    // still win when several of them move the same value. Long groups of short tasks don't get
+    // slower as more of the tasks finish.
+    size_t *active;
+    size_t active_count;
 } Group_Data;
 
-bool group_update(Group_Data *data, Env env);
+Ticks group_update(Group_Data *data, Env env);
+Ticks group_seek(Group_Data *data, Ticks t);
 Task task_group_(Arena *a, ...);
 #define task_group(...) task_group_(__VA_ARGS__, (Task){0})
 
+// A group that spreads the updates of its pure children (see Task_Funcs) across a pool of threads and
+// waits for them before returning, so it's done before anything is drawn. The rest of the children
+// are updated afterwards on the calling thread in their order. The pure children must move different
+// values, otherwise which one wins is up to the scheduler. Meant for thousands of tweens, small
+// groups are updated serially.
+typedef struct {
+    Group_Data group;
+    Ticks *left;        // Written by the threads for every child they updated
+} Group_Parallel_Data;
+
+Ticks group_parallel_update(Group_Parallel_Data *data, Env env);
+Ticks group_parallel_seek(Group_Parallel_Data *data, Ticks t);
+// Takes over the tasks array, build it with arena_da_append() in the same arena
+Task task_group_parallel(Arena *a, Tasks tasks);
+
 typedef struct {
     Tasks tasks;
     size_t it;
 } Seq_Data;
 
-bool seq_update(Seq_Data *data, Env env);
+Ticks seq_update(Seq_Data *data, Env env);
+Ticks seq_seek(Seq_Data *data, Ticks t);
 Task task_seq_(Arena *a, ...);
 #define task_seq(...) task_seq_(__VA_ARGS__, (Task){0})
 
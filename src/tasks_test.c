@@ -0,0 +1,282 @@
+// Checks that seeking the builtin tasks to the beginning of a frame lands on exactly the same state
+// as updating them frame by frame up to it, at frame rates that don't divide the durations.
+// Build with ./nob and run ./build/tasks_test (or just ./nob test)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tasks.h"
+
+#define VALUES_COUNT 8
+#define MAX_FRAMES 1000
+#define PARALLEL_CHILDREN 1100
+
+typedef struct {
+    float values[VALUES_COUNT];
+    Vector2 point;
+    Vector4 color;
+    float many[PARALLEL_CHILDREN];
+} State;
+
+typedef Task (*Scene)(Arena *a, State *s);
+
+static Task scene_wait_then_move(Arena *a, State *s)
+{
+    return task_seq(a,
+        task_wait(a, 0.25),
+        task_move_scalar(a, &s->values[0], 1.0f, 0.25, FUNC_ID));
+}
+
+static Task scene_zero_waits(Arena *a, State *s)
+{
+    return task_seq(a,
+        task_wait(a, 0),
+        task_wait(a, 0),
+        task_move_scalar(a, &s->values[0], 1.0f, 0.25, FUNC_SMOOTHSTEP),
+        task_wait(a, 0));
+}
+
+static Task scene_nested(Arena *a, State *s)
+{
+    return task_seq(a,
+        task_group(a,
+            task_seq(a,
+                task_move_scalar(a, &s->values[0], 1.0f, 0.1, FUNC_SINSTEP),
+                task_move_scalar(a, &s->values[0], 0.5f, 1.0/3, FUNC_SQRT),
+                task_wait(a, 0)),
+            task_move_vec2(a, &s->point, (Vector2) {3.0f, -2.0f}, 0.7, FUNC_SMOOTHSTEP),
+            task_seq(a,
+                task_wait(a, 0.05),
+                task_move_vec4(a, &s->color, (Vector4) {1, 0.5f, 0.25f, 1}, 0.2, FUNC_SINPULSE))),
+        task_move_scalar(a, &s->values[1], 2.0f, 0.15, FUNC_ID),
+        task_group(a,
+            task_move_scalar(a, &s->values[0], 0.0f, 0.45, FUNC_SMOOTHSTEP),
+            task_move_scalar(a, &s->values[1], 0.0f, 0.05, FUNC_ID)));
+}
+
+static Task scene_batch(Arena *a, State *s)
+{
+    Task batch = task_move_batch(a, 1, 4);
+    float one = 1.0f, two = 2.0f, three = 3.0f;
+    task_move_batch_add(batch, &s->values[0], &one, 0.2, FUNC_SMOOTHSTEP);
+    task_move_batch_add(batch, &s->values[1], &two, 0, FUNC_ID);
+    task_move_batch_add(batch, &s->values[2], &three, 0.35, FUNC_SINSTEP);
+    task_move_batch_add(batch, &s->values[3], &one, 0.1, FUNC_ID);
+    return task_seq(a,
+        task_wait(a, 0.1),
+        batch,
+        task_move_scalar(a, &s->values[0], 0.0f, 0.15, FUNC_ID));
+}
+
+// Several moves of the batch move the same value to the same place, which the batch allows
+static Task scene_shared_batch(Arena *a, State *s)
+{
+    Task batch = task_move_batch(a, 2, 6);
+    float targets[][2] = {{1, 2}, {3, 4}, {5, 6}};
+    task_move_batch_add(batch, &s->values[4], targets[0], 0.3, FUNC_SMOOTHSTEP);
+    task_move_batch_add(batch, &s->values[6], targets[1], 0.1, FUNC_ID);
+    task_move_batch_add(batch, &s->values[0], targets[2], 0, FUNC_ID);
+    task_move_batch_add(batch, &s->values[4], targets[0], 0.3, FUNC_SMOOTHSTEP);
+    task_move_batch_add(batch, &s->values[6], targets[1], 0.1, FUNC_ID);
+    return task_seq(a,
+        task_move_scalar(a, &s->values[4], 10.0f, 0.15, FUNC_ID),
+        batch,
+        task_move_scalar(a, &s->values[4], 0.0f, 0.1, FUNC_ID));
+}
+
+static Task scene_parallel(Arena *a, State *s)
+{
+    Tasks tasks = {0};
+    for (size_t i = 0; i < PARALLEL_CHILDREN; ++i) {
+        double duration = 0.05 + 0.01*(i%37);
+        arena_da_append(a, &tasks, task_move_scalar(a, &s->many[i], (float)i, duration, FUNC_SMOOTHSTEP));
+    }
+    return task_seq(a,
+        task_group_parallel(a, tasks),
+        task_move_scalar(a, &s->values[0], 1.0f, 0.25, FUNC_ID));
+}
+
+static struct {
+    const char *name;
+    Scene scene;
+} scenes[] = {
+    {"wait then move", scene_wait_then_move},
+    {"zero waits", scene_zero_waits},
+    {"nested", scene_nested},
+    {"batch", scene_batch},
+    {"shared batch", scene_shared_batch},
+    {"parallel", scene_parallel},
+};
+
+static const int fpss[] = {24, 25, 30, 60, 7, 144};
+
+// Same as the frame clock of panim
+static Ticks frame_ticks(int fps, size_t frame)
+{
+    return (Ticks)frame*TICKS_PER_SECOND/fps;
+}
+
+static Env frame_env(int fps, size_t frame)
+{
+    Ticks time = frame_ticks(fps, frame);
+    Ticks delta = frame_ticks(fps, frame + 1) - time;
+    return (Env) {
+        .delta_time = (float)secs_from_ticks(delta),
+        .frame = frame,
+        .time_ticks = time,
+        .delta_ticks = delta,
+    };
+}
+
+static void state_init(State *s)
+{
+    memset(s, 0, sizeof(*s));
+    for (size_t i = 0; i < VALUES_COUNT; ++i) s->values[i] = -1.0f - i;
+}
+
+static bool check_frame(const char *name, int fps, size_t frame, const char *how, const State *expected, const State *actual)
+{
+    if (memcmp(expected, actual, sizeof(*expected)) == 0) return true;
+    fprintf(stderr, "FAIL: %s at %d fps, frame %zu: %s differs from updating frame by frame\n", name, fps, frame, how);
+    for (size_t i = 0; i < VALUES_COUNT; ++i) {
+        if (expected->values[i] != actual->values[i]) {
+            fprintf(stderr, "    values[%zu]: expected %f, got %f\n", i, expected->values[i], actual->values[i]);
+        }
+    }
+    return false;
+}
+
+static bool test_scene(Arena *a, const char *name, Scene scene, int fps)
+{
+    // The state after every frame of the plain frame by frame update
+    static State frames[MAX_FRAMES];
+    static bool finished[MAX_FRAMES];
+    State s;
+
+    arena_reset(a);
+    task_vtable_rebuild(a);
+    state_init(&s);
+    Task task = scene(a, &s);
+    size_t count = 0;
+    frames[count] = s;
+    finished[count] = false;
+    while (!finished[count]) {
+        if (count + 1 >= MAX_FRAMES) {
+            fprintf(stderr, "FAIL: %s at %d fps does not finish in %d frames\n", name, fps, MAX_FRAMES);
+            return false;
+        }
+        bool done = task_update(task, frame_env(fps, count));
+        count += 1;
+        frames[count] = s;
+        finished[count] = done;
+    }
+
+    // A fresh tree sought straight to every frame
+    for (size_t frame = 0; frame <= count; ++frame) {
+        arena_reset(a);
+        task_vtable_rebuild(a);
+        state_init(&s);
+        task = scene(a, &s);
+        bool done = task_seek(task, frame_ticks(fps, frame)) >= 0;
+        if (!check_frame(name, fps, frame, "seek", &frames[frame], &s)) return false;
+        if (done != finished[frame]) {
+            fprintf(stderr, "FAIL: %s at %d fps, frame %zu: seek says finished=%d\n", name, fps, frame, done);
+            return false;
+        }
+    }
+
+    // One tree sought back and forth, then updated from there
+    arena_reset(a);
+    task_vtable_rebuild(a);
+    state_init(&s);
+    task = scene(a, &s);
+    srand(fps);
+    for (size_t i = 0; i < 2*count; ++i) {
+        size_t frame = rand()%(count + 1);
+        task_seek(task, frame_ticks(fps, frame));
+        if (!check_frame(name, fps, frame, "seek back and forth", &frames[frame], &s)) return false;
+        if (frame < count) {
+            task_update(task, frame_env(fps, frame));
+            if (!check_frame(name, fps, frame + 1, "update after seek", &frames[frame + 1], &s)) return false;
+        }
+    }
+
+    // Rewinding gives back the values from before the first update
+    task_seek(task, 0);
+    if (!check_frame(name, fps, 0, "rewind", &frames[0], &s)) return false;
+
+    return true;
+}
+
+// The batch eases every kind of easing in its own loop, this checks it against separate moves that
+// go through easing_interp() one by one
+static bool test_batch_easings(Arena *a, int fps)
+{
+    static State batched, separate;
+    arena_reset(a);
+    task_vtable_rebuild(a);
+    Vector2 curve[4] = {{0, 0}, {0.7f, 0.1f}, {0.2f, 1.3f}, {1, 1}};
+    Interp_Func custom = easing_register_bezier(a, "test", curve);
+    Interp_Func funcs[COUNT_INTERP_FUNCS + 1];
+    for (size_t i = 0; i < COUNT_INTERP_FUNCS; ++i) funcs[i] = (Interp_Func)i;
+    funcs[COUNT_INTERP_FUNCS] = custom;
+    size_t funcs_count = sizeof(funcs)/sizeof(funcs[0]);
+
+    state_init(&batched);
+    state_init(&separate);
+    Task batch = task_move_batch(a, 1, PARALLEL_CHILDREN);
+    Tasks tasks = {0};
+    for (size_t i = 0; i < PARALLEL_CHILDREN; ++i) {
+        double duration = 0.05 + 0.01*(i%37);
+        Interp_Func func = funcs[(i*7)%funcs_count];
+        float target = (float)i;
+        task_move_batch_add(batch, &batched.many[i], &target, duration, func);
+        arena_da_append(a, &tasks, task_move_scalar(a, &separate.many[i], target, duration, func));
+    }
+    Task group = task_group_parallel(a, tasks);
+
+    for (size_t frame = 0; frame < MAX_FRAMES; ++frame) {
+        Env env = frame_env(fps, frame);
+        bool batch_done = task_update(batch, env);
+        bool group_done = task_update(group, env);
+        if (memcmp(batched.many, separate.many, sizeof(batched.many)) != 0) {
+            fprintf(stderr, "FAIL: batch easings at %d fps, frame %zu: batch differs from separate moves\n", fps, frame);
+            return false;
+        }
+        if (batch_done != group_done) {
+            fprintf(stderr, "FAIL: batch easings at %d fps, frame %zu: batch says finished=%d\n", fps, frame, batch_done);
+            return false;
+        }
+        if (batch_done) return true;
+    }
+    fprintf(stderr, "FAIL: batch easings at %d fps does not finish in %d frames\n", fps, MAX_FRAMES);
+    return false;
+}
+
+int main(void)
+{
+    Arena a = {0};
+    size_t failed = 0;
+    size_t total = 0;
+    for (size_t i = 0; i < sizeof(scenes)/sizeof(scenes[0]); ++i) {
+        for (size_t j = 0; j < sizeof(fpss)/sizeof(fpss[0]); ++j) {
+            total += 1;
+            if (!test_scene(&a, scenes[i].name, scenes[i].scene, fpss[j])) failed += 1;
+        }
+    }
+    for (size_t j = 0; j < sizeof(fpss)/sizeof(fpss[0]); ++j) {
+        total += 1;
+        if (!test_batch_easings(&a, fpss[j])) failed += 1;
+    }
+    arena_free(&a);
+
+    if (failed > 0) {
+        fprintf(stderr, "%zu of %zu task tests failed\n", failed, total);
+        return 1;
+    }
+    printf("All %zu task tests passed\n", total);
+    return 0;
+}
+
+#define ARENA_IMPLEMENTATION
+#include "arena.h"
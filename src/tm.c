@@ -6,7 +6,6 @@
 #include <raylib.h>
 #include <raymath.h>
 
-#include "nob.h"
 #include "env.h"
 #include "interpolators.h"
 #include "tasks.h"
@@ -175,13 +174,14 @@ typedef struct {
     size_t head;
 } Intro_Data;
 
-static bool task_intro_update(Intro_Data *data, Env env)
+static Ticks task_intro_update(void *raw, Env env)
 {
-    if (wait_done(&data->wait)) return true;
+    Intro_Data *data = raw;
+    if (wait_done(&data->wait)) return env.delta_ticks;
     if (!data->wait.started) p->scene.head.index = data->head;
-    bool finished = wait_update(&data->wait, env);
+    Ticks left = wait_update(&data->wait, env);
     p->scene.t = smoothstep(wait_interp(&data->wait));
-    return finished;
+    return left;
 }
 
 static Intro_Data intro_data(size_t head)
@@ -206,21 +206,22 @@ typedef struct {
     Direction dir;
 } Move_Head_Data;
 
-static bool move_head_update(Move_Head_Data *data, Env env)
+static Ticks move_head_update(void *raw, Env env)
 {
-    if (wait_done(&data->wait)) return true;
+    Move_Head_Data *data = raw;
+    if (wait_done(&data->wait)) return env.delta_ticks;
 
-    if (wait_update(&data->wait, env)) {
+    Ticks left = wait_update(&data->wait, env);
+    if (left >= 0) {
         p->scene.head.offset = 0.0f;
         p->scene.head.index += data->dir;
-        return true;
+    } else {
+        p->scene.head.offset = Lerp(0, data->dir, smoothstep(wait_interp(&data->wait)));
     }
-
-    p->scene.head.offset = Lerp(0, data->dir, smoothstep(wait_interp(&data->wait)));
-    return false;
+    return left;
 }
 
-static Move_Head_Data move_head(Direction dir, float duration)
+static Move_Head_Data move_head(Direction dir, double duration)
 {
     return (Move_Head_Data) {
         .wait = wait_data(duration),
@@ -228,7 +229,7 @@ static Move_Head_Data move_head(Direction dir, float duration)
     };
 }
 
-static Task task_move_head(Arena *a, Direction dir, float duration)
+static Task task_move_head(Arena *a, Direction dir, double duration)
 {
     Move_Head_Data data = move_head(dir, duration);
     return (Task) {
@@ -243,9 +244,10 @@ typedef struct {
     Cell *cell;
 } Write_Cell_Data;
 
-static bool write_cell_update(Write_Cell_Data *data, Env env)
+static Ticks write_cell_update(void *raw, Env env)
 {
-    if (wait_done(&data->wait)) return true;
+    Write_Cell_Data *data = raw;
+    if (wait_done(&data->wait)) return env.delta_ticks;
 
     if (!data->wait.started && data->cell) {
         data->cell->symbol_b = data->write;
@@ -253,7 +255,7 @@ static bool write_cell_update(Write_Cell_Data *data, Env env)
     }
 
     float t1 = wait_interp(&data->wait);
-    bool finished = wait_update(&data->wait, env);
+    Ticks left = wait_update(&data->wait, env);
     float t2 = wait_interp(&data->wait);
 
     if (t1 < 0.5 && t2 >= 0.5) {
@@ -262,12 +264,12 @@ static bool write_cell_update(Write_Cell_Data *data, Env env)
 
     if (data->cell) data->cell->t = smoothstep(t2);
 
-    if (finished && data->cell) {
+    if (left >= 0 && data->cell) {
         data->cell->symbol_a = data->cell->symbol_b;
         data->cell->t = 0.0;
     }
 
-    return finished;
+    return left;
 }
 
 static Write_Cell_Data write_cell_data(Cell *cell, Symbol write)
@@ -293,9 +295,10 @@ typedef struct {
     Symbol write;
 } Write_Head_Data;
 
-static bool write_head_update(Write_Head_Data *data, Env env)
+static Ticks write_head_update(void *raw, Env env)
 {
-    if (wait_done(&data->wait)) return true;
+    Write_Head_Data *data = raw;
+    if (wait_done(&data->wait)) return env.delta_ticks;
 
     Cell *cell = NULL;
     if ((size_t)p->scene.head.index < p->scene.tape.count) {
@@ -308,7 +311,7 @@ static bool write_head_update(Write_Head_Data *data, Env env)
     }
 
     float t1 = wait_interp(&data->wait);
-    bool finished = wait_update(&data->wait, env);
+    Ticks left = wait_update(&data->wait, env);
     float t2 = wait_interp(&data->wait);
 
     if (t1 < 0.5 && t2 >= 0.5) {
@@ -317,15 +320,15 @@ static bool write_head_update(Write_Head_Data *data, Env env)
 
     if (cell) cell->t = smoothstep(t2);
 
-    if (finished && cell) {
+    if (left >= 0 && cell) {
         cell->symbol_a = cell->symbol_b;
         cell->t = 0.0;
     }
 
-    return finished;
+    return left;
 }
 
-static Write_Head_Data write_head_data(Symbol write, float duration)
+static Write_Head_Data write_head_data(Symbol write, double duration)
 {
     return (Write_Head_Data) {
         .wait = wait_data(duration),
@@ -333,7 +336,7 @@ static Write_Head_Data write_head_data(Symbol write, float duration)
     };
 }
 
-static Task task_write_head(Arena *a, Symbol write, float duration)
+static Task task_write_head(Arena *a, Symbol write, double duration)
 {
     Write_Head_Data data = write_head_data(write, duration);
     return (Task) {
@@ -347,9 +350,10 @@ typedef struct {
     Symbol write;
 } Write_All_Data;
 
-static bool write_all_update(Write_All_Data *data, Env env)
+static Ticks write_all_update(void *raw, Env env)
 {
-    if (wait_done(&data->wait)) return true;
+    Write_All_Data *data = raw;
+    if (wait_done(&data->wait)) return env.delta_ticks;
 
     if (!data->wait.started) {
         for (size_t i = 0; i < p->scene.tape.count; ++i) {
@@ -359,7 +363,7 @@ static bool write_all_update(Write_All_Data *data, Env env)
     }
 
     float t1 = wait_interp(&data->wait);
-    bool finished = wait_update(&data->wait, env);
+    Ticks left = wait_update(&data->wait, env);
     float t2 = wait_interp(&data->wait);
 
     if (t1 < 0.5 && t2 >= 0.5) {
@@ -370,14 +374,14 @@ static bool write_all_update(Write_All_Data *data, Env env)
         p->scene.tape.items[i].t = smoothstep(t2);
     }
 
-    if (finished) {
+    if (left >= 0) {
         for (size_t i = 0; i < p->scene.tape.count; ++i) {
             p->scene.tape.items[i].t = 0.0f;
             p->scene.tape.items[i].symbol_a = p->scene.tape.items[i].symbol_b;
         }
     }
 
-    return finished;
+    return left;
 }
 
 static Write_All_Data write_all_data(Symbol write)
@@ -403,13 +407,14 @@ typedef struct {
     bool done;
 } Bump_Data;
 
-static bool bump_update(Bump_Data *data, Env env)
+static Ticks bump_update(void *raw, Env env)
 {
-    (void) env;
-    if (data->done) return true;
+    Bump_Data *data = raw;
+    // Takes no time, the whole frame is left for the next task
+    if (data->done) return env.delta_ticks;
     p->scene.table.items[data->row].bump[data->column] = 1.0f;
     data->done = true;
-    return true;
+    return env.delta_ticks;
 }
 
 static Bump_Data bump_data(size_t row, size_t column)
@@ -468,22 +473,28 @@ static void load_assets(void)
 
     task_vtable_rebuild(a);
     p->TASK_INTRO_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)task_intro_update,
+        .name = "intro",
+        .advance = task_intro_update,
     });
     p->TASK_MOVE_HEAD_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)move_head_update,
+        .name = "move_head",
+        .advance = move_head_update,
     });
     p->TASK_WRITE_HEAD_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)write_head_update,
+        .name = "write_head",
+        .advance = write_head_update,
     });
     p->TASK_WRITE_ALL_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)write_all_update,
+        .name = "write_all",
+        .advance = write_all_update,
     });
     p->TASK_WRITE_CELL_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)write_cell_update,
+        .name = "write_cell",
+        .advance = write_cell_update,
     });
     p->TASK_BUMP_TAG = task_vtable_register(a, (Task_Funcs) {
-        .update = (task_update_data_t)bump_update,
+        .name = "bump",
+        .advance = bump_update,
     });
 }
 
@@ -499,7 +510,7 @@ static void unload_assets(void)
     }
 }
 
-static Task task_outro(Arena *a, float duration)
+static Task task_outro(Arena *a, double duration)
 {
     Interp_Func func = FUNC_SMOOTHSTEP;
     return task_group(a,
@@ -625,15 +636,15 @@ void plug_reset(void)
     Symbol nothing = symbol_text(a, " ");
     for (size_t i = 0; i < START_AT_CELL_INDEX; ++i) {
         Cell cell = {.symbol_a = nothing,};
-        nob_da_append(&p->scene.tape, cell);
+        arena_da_append(a, &p->scene.tape, cell);
     }
     for (size_t i = START_AT_CELL_INDEX; i < START_AT_CELL_INDEX + 3; ++i) {
         Cell cell = {.symbol_a = one,};
-        nob_da_append(&p->scene.tape, cell);
+        arena_da_append(a, &p->scene.tape, cell);
     }
     for (size_t i = START_AT_CELL_INDEX + 3; i < TAPE_SIZE; ++i) {
         Cell cell = {.symbol_a = zero,};
-        nob_da_append(&p->scene.tape, cell);
+        arena_da_append(a, &p->scene.tape, cell);
     }
 
     p->scene.head.state.symbol_a = symbol_text(a, "Inc");
@@ -657,6 +668,9 @@ void plug_reset(void)
         task_wait(a, 1.5),
         task_outro(a, INTRO_DURATION),
         task_wait(a, 0.5));
+
+    // Give back the pages the previous run touched beyond what the new scene needs
+    arena_trim(a);
 }
 
 void plug_init(void)
@@ -935,10 +949,38 @@ void plug_update(Env env)
     EndMode2D();
 }
 
+void *plug_snapshot(void)
+{
+    // Everything the tasks touch is either in the scene or in the state arena
+    size_t arena_size = arena_save_size(&p->arena_state);
+    char *snapshot = malloc(sizeof(p->scene) + arena_size);
+    assert(snapshot != NULL && "Buy MORE RAM lol!!");
+    memcpy(snapshot, &p->scene, sizeof(p->scene));
+    arena_save(&p->arena_state, snapshot + sizeof(p->scene));
+    return snapshot;
+}
+
+void plug_restore(void *snapshot)
+{
+    memcpy(&p->scene, snapshot, sizeof(p->scene));
+    arena_load(&p->arena_state, (char*)snapshot + sizeof(p->scene));
+}
+
 bool plug_finished(void)
 {
     return p->scene.finished;
 }
 
+size_t plug_arenas(Plug_Arena *arenas, size_t capacity)
+{
+    Plug_Arena all[] = {
+        {"state", &p->arena_state},
+        {"assets", &p->arena_assets},
+    };
+    size_t count = sizeof(all)/sizeof(all[0]);
+    memcpy(arenas, all, sizeof(all[0])*(count < capacity ? count : capacity));
+    return count;
+}
+
 #define ARENA_IMPLEMENTATION
 #include "arena.h"
@@ -0,0 +1,160 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdatomic.h>
+
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include <raylib.h>
+
+#include "trace.h"
+
+// The writer threads of ffmpeg trace too, so all the writes are serialized
+static pthread_mutex_t trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+static FILE *trace_file = NULL;
+static atomic_bool trace_on = false;
+static bool trace_first_event = true;
+static double trace_epoch = 0;
+
+// The processes started by a traced process (like the workers of a parallel render) inherit the
+// moment it started tracing, so their traces line up with it in trace_merge()
+#define TRACE_EPOCH_ENV "PANIM_TRACE_EPOCH"
+
+static double now_usecs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec*1e6 + ts.tv_nsec*1e-3;
+}
+
+static void write_json_string(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (; *s; ++s) {
+        if (*s == '"' || *s == '\\') fputc('\\', f);
+        if ((unsigned char)*s < ' ') continue;
+        fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+static void write_event(char phase, const char *name, const char *thread_name)
+{
+    if (!atomic_load_explicit(&trace_on, memory_order_relaxed)) return;
+    long tid = syscall(SYS_gettid);
+
+    pthread_mutex_lock(&trace_mutex);
+    if (trace_file != NULL) {
+        double ts = now_usecs() - trace_epoch;
+        fprintf(trace_file, "%s\n{\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%d,\"tid\":%ld", trace_first_event ? "" : ",", phase, ts, getpid(), tid);
+        if (name != NULL) {
+            fprintf(trace_file, ",\"name\":");
+            write_json_string(trace_file, name);
+        }
+        if (thread_name != NULL) {
+            fprintf(trace_file, ",\"args\":{\"name\":");
+            write_json_string(trace_file, thread_name);
+            fprintf(trace_file, "}");
+        }
+        fprintf(trace_file, "}");
+        trace_first_event = false;
+    }
+    pthread_mutex_unlock(&trace_mutex);
+}
+
+bool trace_start(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        TraceLog(LOG_ERROR, "TRACE: could not open %s: %s", path, strerror(errno));
+        return false;
+    }
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    double epoch = now_usecs();
+    const char *inherited_epoch = getenv(TRACE_EPOCH_ENV);
+    if (inherited_epoch != NULL) {
+        epoch = strtod(inherited_epoch, NULL);
+    } else {
+        char epoch_text[64];
+        snprintf(epoch_text, sizeof(epoch_text), "%.3f", epoch);
+        setenv(TRACE_EPOCH_ENV, epoch_text, 1);
+    }
+
+    pthread_mutex_lock(&trace_mutex);
+    trace_file = f;
+    trace_first_event = true;
+    trace_epoch = epoch;
+    atomic_store(&trace_on, true);
+    pthread_mutex_unlock(&trace_mutex);
+
+    trace_thread_name("main");
+    return true;
+}
+
+void trace_stop(void)
+{
+    pthread_mutex_lock(&trace_mutex);
+    atomic_store(&trace_on, false);
+    if (trace_file != NULL) {
+        fprintf(trace_file, "\n]}\n");
+        fclose(trace_file);
+        trace_file = NULL;
+    }
+    pthread_mutex_unlock(&trace_mutex);
+}
+
+bool trace_enabled(void)
+{
+    return atomic_load_explicit(&trace_on, memory_order_relaxed);
+}
+
+void trace_thread_name(const char *name)
+{
+    write_event('M', "thread_name", name);
+}
+
+void trace_begin(const char *name)
+{
+    write_event('B', name, NULL);
+}
+
+void trace_end(void)
+{
+    write_event('E', NULL, NULL);
+}
+
+bool trace_merge(const char *path)
+{
+    if (!trace_enabled()) return true;
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        TraceLog(LOG_ERROR, "TRACE: could not open %s: %s", path, strerror(errno));
+        return false;
+    }
+
+    // trace_start() and write_event() put every event on its own line
+    char *line = NULL;
+    size_t line_capacity = 0;
+    ssize_t n = 0;
+    pthread_mutex_lock(&trace_mutex);
+    while (trace_file != NULL && (n = getline(&line, &line_capacity, f)) > 0) {
+        if (strncmp(line, "{\"ph\"", 5) != 0) continue;
+        while (n > 0 && (line[n - 1] == '\n' || line[n - 1] == ',')) n -= 1;
+        fprintf(trace_file, "%s\n%.*s", trace_first_event ? "" : ",", (int)n, line);
+        trace_first_event = false;
+    }
+    pthread_mutex_unlock(&trace_mutex);
+
+    bool ok = !ferror(f);
+    if (!ok) TraceLog(LOG_ERROR, "TRACE: could not read %s: %s", path, strerror(errno));
+    free(line);
+    fclose(f);
+    return ok;
+}
@@ -0,0 +1,21 @@
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdbool.h>
+
+// Writes what the engine is doing in Chrome Trace Event Format, which can be opened in Perfetto
+// (https://ui.perfetto.dev) or chrome://tracing. Spans are per thread and have to be properly nested.
+// Everything is a no-op until trace_start() succeeds, so the calls can stay in the hot paths.
+
+bool trace_start(const char *path);
+void trace_stop(void);
+bool trace_enabled(void);
+// Names the calling thread in the trace
+void trace_thread_name(const char *name);
+void trace_begin(const char *name);
+void trace_end(void);
+// Appends the events of another trace, e.g. of a render worker, to the current one. The events keep
+// their pid, so every process gets its own track.
+bool trace_merge(const char *path);
+
+#endif // TRACE_H_
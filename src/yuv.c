@@ -0,0 +1,216 @@
+#include <assert.h>
+#include <stdint.h>
+
+#include "yuv.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define YUV_X86
+#include <immintrin.h>
+#endif
+
+// Fixed-point BT.601 limited range:
+//   Y =  ( 66*R + 129*G +  25*B + 128) >> 8) + 16
+//   U = ((-38*R -  74*G + 112*B + 128) >> 8) + 128
+//   V = ((112*R -  94*G -  18*B + 128) >> 8) + 128
+// Chroma is computed from the sum of a 2x2 block, hence the extra >> 2 below.
+
+typedef void (*Row_Pair_Func)(const uint8_t *a, const uint8_t *b, uint8_t *ya, uint8_t *yb, uint8_t *u, uint8_t *v, size_t width);
+
+static inline uint8_t luma(const uint8_t *px)
+{
+    return ((66*px[0] + 129*px[1] + 25*px[2] + 128) >> 8) + 16;
+}
+
+// Converts two adjacent rows `a` and `b` starting from pixel `x` (which must be even)
+static void row_pair_scalar_from(const uint8_t *a, const uint8_t *b, uint8_t *ya, uint8_t *yb, uint8_t *u, uint8_t *v, size_t x, size_t width)
+{
+    for (; x < width; x += 2) {
+        const uint8_t *a0 = a + 4*x, *a1 = a0 + 4;
+        const uint8_t *b0 = b + 4*x, *b1 = b0 + 4;
+        ya[x] = luma(a0); ya[x + 1] = luma(a1);
+        yb[x] = luma(b0); yb[x + 1] = luma(b1);
+
+        int r = a0[0] + a1[0] + b0[0] + b1[0];
+        int g = a0[1] + a1[1] + b0[1] + b1[1];
+        int bl = a0[2] + a1[2] + b0[2] + b1[2];
+        u[x/2] = ((-38*r -  74*g + 112*bl + 512) >> 10) + 128;
+        v[x/2] = ((112*r -  94*g -  18*bl + 512) >> 10) + 128;
+    }
+}
+
+static void row_pair_scalar(const uint8_t *a, const uint8_t *b, uint8_t *ya, uint8_t *yb, uint8_t *u, uint8_t *v, size_t width)
+{
+    row_pair_scalar_from(a, b, ya, yb, u, v, 0, width);
+}
+
+#ifdef YUV_X86
+
+__attribute__((target("sse4.1")))
+static inline __m128i luma4_sse41(__m128i px)
+{
+    const __m128i coef = _mm_setr_epi16(66, 129, 25, 0, 66, 129, 25, 0);
+    __m128i lo = _mm_madd_epi16(_mm_cvtepu8_epi16(px), coef);
+    __m128i hi = _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(px, 8)), coef);
+    __m128i y = _mm_hadd_epi32(lo, hi);
+    y = _mm_srai_epi32(_mm_add_epi32(y, _mm_set1_epi32(128)), 8);
+    return _mm_add_epi32(y, _mm_set1_epi32(16));
+}
+
+// 16 pixels of a single row into 16 luma bytes
+__attribute__((target("sse4.1")))
+static inline __m128i luma16_sse41(const uint8_t *row)
+{
+    __m128i y0 = luma4_sse41(_mm_loadu_si128((const __m128i*)row + 0));
+    __m128i y1 = luma4_sse41(_mm_loadu_si128((const __m128i*)row + 1));
+    __m128i y2 = luma4_sse41(_mm_loadu_si128((const __m128i*)row + 2));
+    __m128i y3 = luma4_sse41(_mm_loadu_si128((const __m128i*)row + 3));
+    return _mm_packus_epi16(_mm_packs_epi32(y0, y1), _mm_packs_epi32(y2, y3));
+}
+
+// 4 pixels from each of the two rows (two 2x2 blocks) into [U0 U1 V0 V1]
+__attribute__((target("sse4.1")))
+static inline __m128i chroma2_sse41(__m128i pa, __m128i pb)
+{
+    const __m128i ucoef = _mm_setr_epi16(-38, -74, 112, 0, -38, -74, 112, 0);
+    const __m128i vcoef = _mm_setr_epi16(112, -94, -18, 0, 112, -94, -18, 0);
+    __m128i s01 = _mm_add_epi16(_mm_cvtepu8_epi16(pa), _mm_cvtepu8_epi16(pb));
+    __m128i s23 = _mm_add_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(pa, 8)), _mm_cvtepu8_epi16(_mm_srli_si128(pb, 8)));
+    __m128i blocks = _mm_add_epi16(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23));
+    __m128i uv = _mm_hadd_epi32(_mm_madd_epi16(blocks, ucoef), _mm_madd_epi16(blocks, vcoef));
+    uv = _mm_srai_epi32(_mm_add_epi32(uv, _mm_set1_epi32(512)), 10);
+    return _mm_add_epi32(uv, _mm_set1_epi32(128));
+}
+
+__attribute__((target("sse4.1")))
+static void row_pair_sse41(const uint8_t *a, const uint8_t *b, uint8_t *ya, uint8_t *yb, uint8_t *u, uint8_t *v, size_t width)
+{
+    // [U0 U1 V0 V1 U2 U3 V2 V3 ...] -> [U0..U7 V0..V7]
+    const __m128i deinterleave = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m128i *pa = (const __m128i*)(a + 4*x);
+        const __m128i *pb = (const __m128i*)(b + 4*x);
+        _mm_storeu_si128((__m128i*)(ya + x), luma16_sse41(a + 4*x));
+        _mm_storeu_si128((__m128i*)(yb + x), luma16_sse41(b + 4*x));
+
+        __m128i c0 = chroma2_sse41(_mm_loadu_si128(pa + 0), _mm_loadu_si128(pb + 0));
+        __m128i c1 = chroma2_sse41(_mm_loadu_si128(pa + 1), _mm_loadu_si128(pb + 1));
+        __m128i c2 = chroma2_sse41(_mm_loadu_si128(pa + 2), _mm_loadu_si128(pb + 2));
+        __m128i c3 = chroma2_sse41(_mm_loadu_si128(pa + 3), _mm_loadu_si128(pb + 3));
+        __m128i uv = _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+        uv = _mm_shuffle_epi8(uv, deinterleave);
+        _mm_storel_epi64((__m128i*)(u + x/2), uv);
+        _mm_storel_epi64((__m128i*)(v + x/2), _mm_srli_si128(uv, 8));
+    }
+    row_pair_scalar_from(a, b, ya, yb, u, v, x, width);
+}
+
+// 4 pixels (16 bytes) widened into 16-bit channels and multiplied-added with coef
+__attribute__((target("avx2")))
+static inline __m256i madd4_avx2(const uint8_t *px, __m256i coef)
+{
+    return _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)px)), coef);
+}
+
+// 32 pixels of a single row into 32 luma bytes
+__attribute__((target("avx2")))
+static inline __m256i luma32_avx2(const uint8_t *row)
+{
+    const __m256i coef = _mm256_setr_epi16(66, 129, 25, 0, 66, 129, 25, 0, 66, 129, 25, 0, 66, 129, 25, 0);
+    const __m256i round = _mm256_set1_epi32(128);
+    const __m256i offset = _mm256_set1_epi32(16);
+
+    __m256i y[4];
+    for (int i = 0; i < 4; ++i) {
+        // Within 128-bit lanes: [p0 p1 p4 p5 | p2 p3 p6 p7] of the 8 pixels
+        __m256i h = _mm256_hadd_epi32(madd4_avx2(row + 32*i, coef), madd4_avx2(row + 32*i + 16, coef));
+        y[i] = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(h, round), 8), offset);
+    }
+    __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(y[0], y[1]), _mm256_packs_epi32(y[2], y[3]));
+    // Undo the lane interleaving of hadd/packs: first regroup the 32-bit pairs across lanes, then the 16-bit pixel pairs within them
+    bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    const __m256i pairs = _mm256_setr_epi8(
+        0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15,
+        0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15);
+    return _mm256_shuffle_epi8(bytes, pairs);
+}
+
+__attribute__((target("avx2")))
+static void row_pair_avx2(const uint8_t *a, const uint8_t *b, uint8_t *ya, uint8_t *yb, uint8_t *u, uint8_t *v, size_t width)
+{
+    const __m256i ucoef = _mm256_setr_epi16(-38, -74, 112, 0, -38, -74, 112, 0, -38, -74, 112, 0, -38, -74, 112, 0);
+    const __m256i vcoef = _mm256_setr_epi16(112, -94, -18, 0, 112, -94, -18, 0, 112, -94, -18, 0, 112, -94, -18, 0);
+    const __m256i round = _mm256_set1_epi32(512);
+    const __m256i offset = _mm256_set1_epi32(128);
+    // [U0 U2 V0 V2 U4 U6 V4 V6 ...] -> [U0 U2 .. U14 V0 V2 .. V14] in the low lane, same for the odd blocks in the high lane
+    const __m256i deinterleave = _mm256_setr_epi8(
+        0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+        0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+
+    size_t x = 0;
+    for (; x + 32 <= width; x += 32) {
+        const uint8_t *pa = a + 4*x;
+        const uint8_t *pb = b + 4*x;
+        _mm256_storeu_si256((__m256i*)(ya + x), luma32_avx2(pa));
+        _mm256_storeu_si256((__m256i*)(yb + x), luma32_avx2(pb));
+
+        __m256i s[8];
+        for (int i = 0; i < 8; ++i) {
+            // Low lane holds the pixels of block 2i, high lane the pixels of block 2i + 1
+            __m256i ra = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(pa + 16*i)));
+            __m256i rb = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(pb + 16*i)));
+            s[i] = _mm256_add_epi16(ra, rb);
+        }
+        __m256i c[4];
+        for (int i = 0; i < 4; ++i) {
+            __m256i lo = s[2*i], hi = s[2*i + 1];
+            __m256i blocks = _mm256_add_epi16(_mm256_unpacklo_epi64(lo, hi), _mm256_unpackhi_epi64(lo, hi));
+            __m256i uv = _mm256_hadd_epi32(_mm256_madd_epi16(blocks, ucoef), _mm256_madd_epi16(blocks, vcoef));
+            c[i] = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(uv, round), 10), offset);
+        }
+        __m256i uv = _mm256_packus_epi16(_mm256_packs_epi32(c[0], c[1]), _mm256_packs_epi32(c[2], c[3]));
+        uv = _mm256_shuffle_epi8(uv, deinterleave);
+        __m128i even = _mm256_castsi256_si128(uv);
+        __m128i odd = _mm256_extracti128_si256(uv, 1);
+        _mm_storeu_si128((__m128i*)(u + x/2), _mm_unpacklo_epi8(even, odd));
+        _mm_storeu_si128((__m128i*)(v + x/2), _mm_unpackhi_epi8(even, odd));
+    }
+    row_pair_scalar_from(a, b, ya, yb, u, v, x, width);
+}
+
+#endif // YUV_X86
+
+static Row_Pair_Func pick_row_pair_func(void)
+{
+#ifdef YUV_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return row_pair_avx2;
+    if (__builtin_cpu_supports("sse4.1")) return row_pair_sse41;
+#endif // YUV_X86
+    return row_pair_scalar;
+}
+
+void rgba_flipped_to_yuv420p(const void *rgba, size_t width, size_t height, void *yuv)
+{
+    static Row_Pair_Func row_pair = NULL;
+    if (row_pair == NULL) row_pair = pick_row_pair_func();
+
+    assert(width%2 == 0 && height%2 == 0);
+    const uint8_t *src = rgba;
+    uint8_t *y_plane = yuv;
+    uint8_t *u_plane = y_plane + width*height;
+    uint8_t *v_plane = u_plane + (width/2)*(height/2);
+    size_t stride = 4*width;
+
+    for (size_t y = 0; y < height; y += 2) {
+        row_pair(
+            src + (height - y - 1)*stride,
+            src + (height - y - 2)*stride,
+            y_plane + y*width,
+            y_plane + (y + 1)*width,
+            u_plane + (y/2)*(width/2),
+            v_plane + (y/2)*(width/2),
+            width);
+    }
+}
@@ -0,0 +1,14 @@
+#ifndef YUV_H_
+#define YUV_H_
+
+#include <stddef.h>
+
+// Size of a planar YUV 4:2:0 image (a.k.a. I420 or yuv420p in ffmpeg terms). Both width and height must be even.
+#define YUV420P_SIZE(width, height) ((width)*(height) + 2*((width)/2)*((height)/2))
+
+// Converts a bottom-to-top RGBA8 image (what we read back from OpenGL) into a top-to-bottom
+// yuv420p image using limited range BT.601 coefficients, same as ffmpeg does by default.
+// The alpha channel is ignored. Uses AVX2 or SSE4.1 if the CPU supports them.
+void rgba_flipped_to_yuv420p(const void *rgba, size_t width, size_t height, void *yuv);
+
+#endif // YUV_H_